@@ -0,0 +1,29 @@
+#pragma once
+
+#include <munin/component.hpp>
+#include <terminalpp/extent.hpp>
+#include <memory>
+
+//* =========================================================================
+/// \brief Returns a component that nests the given number of titled frames
+/// and framed components around an edit control.
+//* =========================================================================
+std::shared_ptr<munin::component> make_nested_frames(int depth);
+
+//* =========================================================================
+/// \brief Returns a typical application screen: a compass layout with a
+/// title, a status line, a sidebar and a framed edit control in the centre.
+//* =========================================================================
+std::shared_ptr<munin::component> make_compass_screen();
+
+//* =========================================================================
+/// \brief Returns a grid of the given dimensions, each cell of which
+/// contains an image.
+//* =========================================================================
+std::shared_ptr<munin::component> make_image_grid(terminalpp::extent cells);
+
+//* =========================================================================
+/// \brief Returns a viewport over a text area that contains the given 
+/// number of lines of text.
+//* =========================================================================
+std::shared_ptr<munin::component> make_text_viewport(int lines);
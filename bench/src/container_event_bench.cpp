@@ -0,0 +1,44 @@
+#include "trees.hpp"
+#include <terminalpp/virtual_key.hpp>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// ==========================================================================
+// DISPATCH_KEYSTROKE
+// ==========================================================================
+void dispatch_keystroke(
+    benchmark::State &state,
+    std::shared_ptr<munin::component> (*make_content)())
+{
+    auto const content = make_content();
+    content->set_size({
+        terminalpp::coordinate_type(state.range(0)),
+        terminalpp::coordinate_type(state.range(1))});
+    content->set_focus();
+
+    // Alternate between inserting and deleting a character so that the
+    // content of the edit does not grow without bound.
+    auto const insert = terminalpp::virtual_key{terminalpp::vk::lowercase_e};
+    auto const erase  = terminalpp::virtual_key{terminalpp::vk::bs};
+
+    for (auto _ : state)
+    {
+        content->event(insert);
+        content->event(erase);
+    }
+}
+
+std::shared_ptr<munin::component> nested_frames()
+{
+    return make_nested_frames(8);
+}
+
+}
+
+BENCHMARK_CAPTURE(dispatch_keystroke, nested_frames, nested_frames)
+    ->Args({80, 24})
+    ->Args({300, 100});
+BENCHMARK_CAPTURE(dispatch_keystroke, compass_screen, make_compass_screen)
+    ->Args({80, 24})
+    ->Args({300, 100});
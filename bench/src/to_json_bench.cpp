@@ -0,0 +1,42 @@
+#include "trees.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// ==========================================================================
+// CONVERT_TO_JSON
+// ==========================================================================
+void convert_to_json(
+    benchmark::State &state,
+    std::shared_ptr<munin::component> (*make_content)())
+{
+    auto const content = make_content();
+    content->set_size({
+        terminalpp::coordinate_type(state.range(0)),
+        terminalpp::coordinate_type(state.range(1))});
+
+    for (auto _ : state)
+    {
+        auto json = content->to_json();
+        benchmark::DoNotOptimize(json);
+    }
+}
+
+std::shared_ptr<munin::component> nested_frames()
+{
+    return make_nested_frames(8);
+}
+
+std::shared_ptr<munin::component> image_grid()
+{
+    return make_image_grid({20, 20});
+}
+
+}
+
+BENCHMARK_CAPTURE(convert_to_json, nested_frames, nested_frames)
+    ->Args({80, 24});
+BENCHMARK_CAPTURE(convert_to_json, compass_screen, make_compass_screen)
+    ->Args({80, 24});
+BENCHMARK_CAPTURE(convert_to_json, image_grid, image_grid)
+    ->Args({300, 100});
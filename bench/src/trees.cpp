@@ -0,0 +1,89 @@
+#include "trees.hpp"
+#include <munin/compass_layout.hpp>
+#include <munin/edit.hpp>
+#include <munin/framed_component.hpp>
+#include <munin/grid_layout.hpp>
+#include <munin/image.hpp>
+#include <munin/text_area.hpp>
+#include <munin/titled_frame.hpp>
+#include <munin/view.hpp>
+#include <munin/viewport.hpp>
+#include <string>
+
+using namespace terminalpp::literals;
+
+// ==========================================================================
+// MAKE_NESTED_FRAMES
+// ==========================================================================
+std::shared_ptr<munin::component> make_nested_frames(int depth)
+{
+    std::shared_ptr<munin::component> content = munin::make_edit();
+
+    for (int level = 0; level < depth; ++level)
+    {
+        content = munin::make_framed_component(
+            munin::make_titled_frame(
+                terminalpp::string("Level " + std::to_string(level))),
+            content);
+    }
+
+    return content;
+}
+
+// ==========================================================================
+// MAKE_COMPASS_SCREEN
+// ==========================================================================
+std::shared_ptr<munin::component> make_compass_screen()
+{
+    auto const edit = munin::make_edit();
+
+    return munin::view(
+        munin::make_compass_layout(),
+        munin::make_image("Munin Benchmark"_ts),
+        munin::compass_layout::heading::north,
+        munin::make_image(std::vector<terminalpp::string>(
+            20, "Sidebar item"_ts)),
+        munin::compass_layout::heading::west,
+        munin::make_framed_component(
+            munin::make_titled_frame("Input"_ts, edit),
+            edit),
+        munin::compass_layout::heading::centre,
+        munin::make_image("Status: OK"_ts),
+        munin::compass_layout::heading::south);
+}
+
+// ==========================================================================
+// MAKE_IMAGE_GRID
+// ==========================================================================
+std::shared_ptr<munin::component> make_image_grid(terminalpp::extent cells)
+{
+    auto grid = munin::view(munin::make_grid_layout(cells));
+
+    for (int cell = 0; cell < cells.width * cells.height; ++cell)
+    {
+        grid->add_component(
+            munin::make_image(terminalpp::string(std::to_string(cell))));
+    }
+
+    return grid;
+}
+
+// ==========================================================================
+// MAKE_TEXT_VIEWPORT
+// ==========================================================================
+std::shared_ptr<munin::component> make_text_viewport(int lines)
+{
+    std::string text;
+    
+    for (int line = 0; line < lines; ++line)
+    {
+        text += "The quick brown fox jumps over the lazy dog, line "
+              + std::to_string(line)
+              + "\n";
+    }
+
+    auto const text_area = munin::make_text_area();
+    text_area->insert_text(terminalpp::string(text));
+
+    return munin::make_viewport(text_area);
+}
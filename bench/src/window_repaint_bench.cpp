@@ -0,0 +1,145 @@
+#include "trees.hpp"
+#include <munin/window.hpp>
+#include <terminalpp/canvas.hpp>
+#include <terminalpp/terminal.hpp>
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// The canvas sizes range from a classic terminal to a large, modern one.
+void canvas_sizes(benchmark::internal::Benchmark *bench)
+{
+    bench->Args({80, 24})
+         ->Args({132, 43})
+         ->Args({200, 60})
+         ->Args({300, 100});
+}
+
+// ==========================================================================
+// REPAINT_ENTIRE_WINDOW
+// ==========================================================================
+void repaint_entire_window(
+    benchmark::State &state,
+    std::shared_ptr<munin::component> (*make_content)())
+{
+    auto const canvas_size = terminalpp::extent(
+        terminalpp::coordinate_type(state.range(0)), 
+        terminalpp::coordinate_type(state.range(1)));
+
+    auto const content = make_content();
+    munin::window window{content};
+    terminalpp::canvas canvas{canvas_size};
+    terminalpp::terminal terminal;
+    std::string paint_data;
+    
+    window.repaint(canvas, terminal, paint_data);
+
+    for (auto _ : state)
+    {
+        paint_data.clear();
+        content->on_redraw({{{}, canvas_size}});
+        window.repaint(canvas, terminal, paint_data);
+        benchmark::DoNotOptimize(paint_data.data());
+    }
+}
+
+// ==========================================================================
+// REPAINT_ONE_CELL
+// ==========================================================================
+void repaint_one_cell(
+    benchmark::State &state,
+    std::shared_ptr<munin::component> (*make_content)())
+{
+    auto const canvas_size = terminalpp::extent(
+        terminalpp::coordinate_type(state.range(0)), 
+        terminalpp::coordinate_type(state.range(1)));
+
+    auto const content = make_content();
+    munin::window window{content};
+    terminalpp::canvas canvas{canvas_size};
+    terminalpp::terminal terminal;
+    std::string paint_data;
+    
+    window.repaint(canvas, terminal, paint_data);
+
+    for (auto _ : state)
+    {
+        paint_data.clear();
+        content->on_redraw({{{canvas_size.width / 2, canvas_size.height / 2}, {1, 1}}});
+        window.repaint(canvas, terminal, paint_data);
+        benchmark::DoNotOptimize(paint_data.data());
+    }
+}
+
+// ==========================================================================
+// RESIZE_WINDOW
+// ==========================================================================
+void resize_window(
+    benchmark::State &state,
+    std::shared_ptr<munin::component> (*make_content)())
+{
+    auto const canvas_size = terminalpp::extent(
+        terminalpp::coordinate_type(state.range(0)), 
+        terminalpp::coordinate_type(state.range(1)));
+    auto const other_size = terminalpp::extent(
+        canvas_size.width - 1, canvas_size.height - 1);
+
+    auto const content = make_content();
+    munin::window window{content};
+    terminalpp::canvas canvas{canvas_size};
+    terminalpp::canvas other_canvas{other_size};
+    terminalpp::terminal terminal;
+    std::string paint_data;
+
+    for (auto _ : state)
+    {
+        paint_data.clear();
+        window.repaint(canvas, terminal, paint_data);
+        window.repaint(other_canvas, terminal, paint_data);
+        benchmark::DoNotOptimize(paint_data.data());
+    }
+}
+
+std::shared_ptr<munin::component> nested_frames()
+{
+    return make_nested_frames(8);
+}
+
+std::shared_ptr<munin::component> image_grid()
+{
+    return make_image_grid({20, 20});
+}
+
+std::shared_ptr<munin::component> text_viewport()
+{
+    return make_text_viewport(5000);
+}
+
+}
+
+BENCHMARK_CAPTURE(repaint_entire_window, nested_frames, nested_frames)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_entire_window, compass_screen, make_compass_screen)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_entire_window, image_grid, image_grid)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_entire_window, text_viewport, text_viewport)
+    ->Apply(canvas_sizes);
+
+BENCHMARK_CAPTURE(repaint_one_cell, nested_frames, nested_frames)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_one_cell, compass_screen, make_compass_screen)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_one_cell, image_grid, image_grid)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(repaint_one_cell, text_viewport, text_viewport)
+    ->Apply(canvas_sizes);
+
+BENCHMARK_CAPTURE(resize_window, nested_frames, nested_frames)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(resize_window, compass_screen, make_compass_screen)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(resize_window, image_grid, image_grid)
+    ->Apply(canvas_sizes);
+BENCHMARK_CAPTURE(resize_window, text_viewport, text_viewport)
+    ->Apply(canvas_sizes);
@@ -1,43 +1,10 @@
 #pragma once
 
+#include "munin/alignment.hpp"
 #include "munin/layout.hpp"
 
 namespace munin {
 
-enum class horizontal_alignment
-{
-    left,
-    centre,
-    right,
-    fill,
-};
-
-enum class vertical_alignment
-{
-    top,
-    centre,
-    bottom,
-    fill,
-};
-
-//* =========================================================================
-/// \brief A hint for an aligned_layout about where to place the component.
-//* =========================================================================
-struct alignment
-{
-    //* =====================================================================
-    /// \brief Where to place the component horizontally 
-    /// (left, centre, right)
-    //* =====================================================================
-    horizontal_alignment horizontal;
-
-    //* =====================================================================
-    /// \brief Where to place the component vertically
-    /// (top, centre, bottom)
-    //* =====================================================================
-    vertical_alignment   vertical;
-};
-
 //* =========================================================================
 /// \brief A class that knows how to lay components out in a container in
 /// a aligned manner.
@@ -53,7 +20,7 @@ protected :
     //* =====================================================================
     terminalpp::extent do_get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const override;
+        std::vector<layout_hint>                const &hints) const override;
 
     //* =====================================================================
     /// \brief Called by operator().  Derived classes must override this
@@ -62,7 +29,7 @@ protected :
     //* =====================================================================
     void do_layout(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const override;
 
     //* =====================================================================
@@ -79,56 +46,4 @@ protected :
 MUNIN_EXPORT
 std::unique_ptr<layout> make_aligned_layout();
 
-// Now a selection of alignment constants that you can use.
-
-static constexpr alignment const alignment_hlvt = {
-    horizontal_alignment::left,
-    vertical_alignment::top
-};
-
-static constexpr alignment const alignment_hcvt = {
-    horizontal_alignment::centre,
-    vertical_alignment::top
-};
-
-static constexpr alignment const alignment_hrvt = {
-    horizontal_alignment::right,
-    vertical_alignment::top
-};
-
-static constexpr alignment const alignment_hlvc = {
-    horizontal_alignment::left,
-    vertical_alignment::centre
-};
-
-static constexpr alignment const alignment_hcvc = {
-    horizontal_alignment::centre,
-    vertical_alignment::centre
-};
-
-static constexpr alignment const alignment_hrvc = {
-    horizontal_alignment::right,
-    vertical_alignment::centre
-};
-
-static constexpr alignment const alignment_hlvb = {
-    horizontal_alignment::left,
-    vertical_alignment::bottom
-};
-
-static constexpr alignment const alignment_hcvb = {
-    horizontal_alignment::centre,
-    vertical_alignment::bottom
-};
-
-static constexpr alignment const alignment_hrvb = {
-    horizontal_alignment::right,
-    vertical_alignment::bottom
-};
-
-static constexpr alignment const alignment_fill = {
-    horizontal_alignment::fill,
-    vertical_alignment::fill
-};
-
 }
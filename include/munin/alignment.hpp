@@ -0,0 +1,91 @@
+#pragma once
+
+namespace munin {
+
+enum class horizontal_alignment
+{
+    left,
+    centre,
+    right,
+    fill,
+};
+
+enum class vertical_alignment
+{
+    top,
+    centre,
+    bottom,
+    fill,
+};
+
+//* =========================================================================
+/// \brief A hint for an aligned_layout about where to place the component.
+//* =========================================================================
+struct alignment
+{
+    //* =====================================================================
+    /// \brief Where to place the component horizontally 
+    /// (left, centre, right)
+    //* =====================================================================
+    horizontal_alignment horizontal;
+
+    //* =====================================================================
+    /// \brief Where to place the component vertically
+    /// (top, centre, bottom)
+    //* =====================================================================
+    vertical_alignment   vertical;
+};
+
+// Now a selection of alignment constants that you can use.
+
+static constexpr alignment const alignment_hlvt = {
+    horizontal_alignment::left,
+    vertical_alignment::top
+};
+
+static constexpr alignment const alignment_hcvt = {
+    horizontal_alignment::centre,
+    vertical_alignment::top
+};
+
+static constexpr alignment const alignment_hrvt = {
+    horizontal_alignment::right,
+    vertical_alignment::top
+};
+
+static constexpr alignment const alignment_hlvc = {
+    horizontal_alignment::left,
+    vertical_alignment::centre
+};
+
+static constexpr alignment const alignment_hcvc = {
+    horizontal_alignment::centre,
+    vertical_alignment::centre
+};
+
+static constexpr alignment const alignment_hrvc = {
+    horizontal_alignment::right,
+    vertical_alignment::centre
+};
+
+static constexpr alignment const alignment_hlvb = {
+    horizontal_alignment::left,
+    vertical_alignment::bottom
+};
+
+static constexpr alignment const alignment_hcvb = {
+    horizontal_alignment::centre,
+    vertical_alignment::bottom
+};
+
+static constexpr alignment const alignment_hrvb = {
+    horizontal_alignment::right,
+    vertical_alignment::bottom
+};
+
+static constexpr alignment const alignment_fill = {
+    horizontal_alignment::fill,
+    vertical_alignment::fill
+};
+
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "munin/basic_component.hpp"
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A component that draws another component into a private canvas,
+/// and thereafter copies from that canvas rather than drawing the other
+/// component again.
+/// \par
+/// Only those regions that the cached component announces with on_redraw
+/// are drawn again, and the entire cache is discarded when the size
+/// changes.  This is suited to components whose content changes rarely
+/// compared to how often they are drawn, such as frames, banners and 
+/// backgrounds.
+//* =========================================================================
+class MUNIN_EXPORT cached_component : public basic_component
+{
+public:
+    //* =====================================================================
+    /// \brief Constructor
+    //* =====================================================================
+    explicit cached_component(std::shared_ptr<component> cached);
+
+    //* =====================================================================
+    /// \brief Destructor
+    //* =====================================================================
+    ~cached_component() override;
+
+private:
+    //* =====================================================================
+    /// \brief Called by set_size().  Derived classes must override this
+    /// function in order to set the size of the component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_size(terminalpp::extent const &size) override;
+
+    //* =====================================================================
+    /// \brief Called by get_preferred_size().  Derived classes must override
+    /// this function in order to get the size of the component in a custom
+    /// manner.
+    //* =====================================================================
+    terminalpp::extent do_get_preferred_size() const override;
+
+    //* =====================================================================
+    /// \brief Called by has_focus().  Derived classes must override this
+    /// function in order to return whether this component has focus in a
+    /// custom manner.
+    //* =====================================================================
+    bool do_has_focus() const override;
+
+    //* =====================================================================
+    /// \brief Called by set_focus().  Derived classes must override this
+    /// function in order to set the focus to this component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_focus() override;
+
+    //* =====================================================================
+    /// \brief Called by lose_focus().  Derived classes must override this
+    /// function in order to lose the focus from this component in a
+    /// custom manner.
+    //* =====================================================================
+    void do_lose_focus() override;
+
+    //* =====================================================================
+    /// \brief Called by focus_next().  Derived classes must override this
+    /// function in order to move the focus in a custom manner.
+    //* =====================================================================
+    void do_focus_next() override;
+
+    //* =====================================================================
+    /// \brief Called by focus_previous().  Derived classes must override
+    /// this function in order to move the focus in a custom manner.
+    //* =====================================================================
+    void do_focus_previous() override;
+
+    //* =====================================================================
+    /// \brief Called by get_cursor_state().  Derived classes must override
+    /// this function in order to return the cursor state in a custom manner.
+    //* =====================================================================
+    bool do_get_cursor_state() const override;
+
+    //* =====================================================================
+    /// \brief Called by get_cursor_position().  Derived classes must
+    /// override this function in order to return the cursor position in
+    /// a custom manner.
+    //* =====================================================================
+    terminalpp::point do_get_cursor_position() const override;
+
+    //* =====================================================================
+    /// \brief Called by set_cursor_position().  Derived classes must
+    /// override this function in order to set the cursor position in
+    /// a custom manner.
+    //* =====================================================================
+    void do_set_cursor_position(terminalpp::point const &position) override;
+
+    //* =====================================================================
+    /// \brief Called by draw().  Derived classes must override this function
+    /// in order to draw onto the passed canvas.  A component must only draw
+    /// the part of itself specified by the region.
+    ///
+    /// \param surface the surface on which the component should draw itself.
+    /// \param region the region relative to this component's origin that
+    /// should be drawn.
+    //* =====================================================================
+    void do_draw(
+        render_surface &surface,
+        terminalpp::rectangle const &region) const override;
+
+    //* =====================================================================
+    /// \brief Called by is_opaque().  The cache is drawn exactly as the
+    /// cached component would draw itself, so this forwards to it.
+    //* =====================================================================
+    bool do_is_opaque() const override;
+
+    //* =====================================================================
+    /// \brief Called by event().  Derived classes must override this
+    /// function in order to handle events in a custom manner.
+    //* =====================================================================
+    void do_event(boost::any const &event) override;
+
+    //* =====================================================================
+    /// \brief Called by to_json().  Derived classes must override this
+    /// function in order to add additional data about their implementation
+    /// in a custom manner.
+    //* =====================================================================
+    nlohmann::json do_to_json() const override;
+
+    struct impl;
+    std::unique_ptr<impl> pimpl_;
+};
+
+//* =========================================================================
+/// \brief Returns a newly created cached component.
+//* =========================================================================
+MUNIN_EXPORT
+std::shared_ptr<cached_component> make_cached_component(
+    std::shared_ptr<component> cached);
+
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace munin {
+
+//* =========================================================================
+/// \brief An enumeration of possible compass headings within a
+/// compass_layout.
+//* =========================================================================
+enum class compass_heading
+{
+    centre,
+    north,
+    south,
+    east,
+    west
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "munin/compass_heading.hpp"
 #include "munin/layout.hpp"
 
 namespace munin {
@@ -33,14 +34,7 @@ public :
     /// \brief An enumeration of possible compass headings within the
     /// layout.
     //* =====================================================================
-    enum class heading
-    {
-        centre,
-        north,
-        south,
-        east,
-        west
-    };
+    using heading = compass_heading;
 
 protected :
     //* =====================================================================
@@ -50,7 +44,7 @@ protected :
     //* =====================================================================
     terminalpp::extent do_get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const override;
+        std::vector<layout_hint>                const &hints) const override;
 
     //* =====================================================================
     /// \brief Called by operator().  Derived classes must override this
@@ -59,7 +53,7 @@ protected :
     //* =====================================================================
     void do_layout(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const override;
 
     //* =====================================================================
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "munin/export.hpp"
+#include "munin/rectangle_list.hpp"
 #include <terminalpp/extent.hpp>
 #include <terminalpp/point.hpp>
 #include <terminalpp/rectangle.hpp>
 #include <nlohmann/json.hpp>
 #include <boost/any.hpp>
+#include <boost/optional.hpp>
 #include <boost/signals2/signal.hpp>
 #include <memory>
 #include <vector>
@@ -37,7 +39,8 @@ public :
     void set_position(terminalpp::point const &position);
 
     //* =====================================================================
-    /// \brief Retrieve the position of this component.
+    /// \brief Retrieve the position of this component.  Any layout of
+    /// this component that is pending is performed first.
     //* =====================================================================
     terminalpp::point get_position() const;
 
@@ -51,7 +54,8 @@ public :
     void set_size(terminalpp::extent const &size);
 
     //* =====================================================================
-    /// \brief Retreives the size of this component.
+    /// \brief Retreives the size of this component.  Any layout of this
+    /// component that is pending is performed first.
     //* =====================================================================
     terminalpp::extent get_size() const;
 
@@ -66,6 +70,9 @@ public :
     /// Static Text Box
     /// \endcode
     /// would be (15, 2).
+    /// \par
+    /// The preferred size is remembered between calls, so components must
+    /// signal on_preferred_size_changed whenever it changes.
     //* =====================================================================
     terminalpp::extent get_preferred_size() const;
 
@@ -127,6 +134,13 @@ public :
         render_surface &surface
       , terminalpp::rectangle const &region) const;
 
+    //* =====================================================================
+    /// \brief Returns true if drawing the component writes to every cell
+    /// within its bounds, false otherwise.  Containers need not draw any
+    /// part of a subcomponent that is covered by a later, opaque sibling.
+    //* =====================================================================
+    bool is_opaque() const;
+
     //* =====================================================================
     /// \brief Send an event to the component.  This may be of any type.
     /// A component must specify the types of messages it may receive and
@@ -147,9 +161,31 @@ public :
     //* =====================================================================
     boost::signals2::signal
     <
-        void (std::vector<terminalpp::rectangle> const &regions)
+        void (rectangle_list const &regions)
     > on_redraw;
 
+    //* =====================================================================
+    /// \fn on_scroll
+    /// \param region The region of the component whose content has moved.
+    /// \param rows The number of rows by which the content has moved up.
+    ///        If negative, the content has moved down.
+    /// \brief Connect to this signal in order to receive notifications about
+    /// when the content of a region of the component has moved vertically
+    /// without otherwise changing, so that what was previously drawn may
+    /// be moved rather than drawn again.
+    /// \par
+    /// A slot returns true if it accepts responsibility for moving the 
+    /// content.  If no slot does so, the component announces a redraw of 
+    /// the whole region instead.  Either way, the rows exposed by the move 
+    /// are then announced with on_redraw.
+    //* =====================================================================
+    boost::signals2::signal
+    <
+        bool (
+            terminalpp::rectangle const &region, 
+            terminalpp::coordinate_type  rows)
+    > on_scroll;
+
     //* =====================================================================
     /// \fn on_preferred_size_changed
     /// \brief Certain components sizes want to change during their lifetime,
@@ -205,7 +241,7 @@ protected :
     //* =====================================================================
     /// \brief Constructor
     //* =====================================================================
-    component() = default;
+    component();
 
     //* =====================================================================
     /// \brief Called by set_position().  Derived classes must override this
@@ -308,6 +344,13 @@ protected :
         render_surface &surface,
         terminalpp::rectangle const &region) const = 0;
 
+    //* =====================================================================
+    /// \brief Called by is_opaque().  Derived classes may override this
+    /// function in order to declare that they write to every cell within
+    /// their bounds when drawn.  By default, components are not opaque.
+    //* =====================================================================
+    virtual bool do_is_opaque() const;
+
     //* =====================================================================
     /// \brief Called by event().  Derived classes must override this
     /// function in order to handle events in a custom manner.
@@ -320,6 +363,46 @@ protected :
     /// in a custom manner.
     //* =====================================================================
     virtual nlohmann::json do_to_json() const = 0;
+
+    //* =====================================================================
+    /// \brief Called before the position or size of a subcomponent of this
+    /// component is read.  Derived classes that defer laying out their
+    /// subcomponents must override this function in order to perform any
+    /// pending layout.  By default, this does nothing.
+    //* =====================================================================
+    virtual void do_flush_layout() const;
+
+    //* =====================================================================
+    /// \brief Records that the position and size of a subcomponent are
+    /// decided by owner, usually the container that lays it out.  Reading
+    /// the subcomponent's position or size then first flushes any layout
+    /// that the owner, or any of its own owners, has deferred.
+    //* =====================================================================
+    static void set_layout_owner(
+        component &subcomponent, component const &owner);
+
+    //* =====================================================================
+    /// \brief Releases a subcomponent from owner, if owner is the component
+    /// that currently decides its position and size.
+    //* =====================================================================
+    static void release_layout_owner(
+        component &subcomponent, component const &owner);
+
+private :
+    //* =====================================================================
+    /// \brief Performs any layout deferred by the owners of this component,
+    /// outermost first, so that its position and size are up to date.
+    //* =====================================================================
+    void flush_owner_layout() const;
+
+    // The component, if any, that decides the position and size of this
+    // one.
+    component const *layout_owner_ = nullptr;
+
+    // The result of do_get_preferred_size() is remembered until the
+    // component announces that it has changed via 
+    // on_preferred_size_changed.
+    mutable boost::optional<terminalpp::extent> preferred_size_;
 };
 
 }
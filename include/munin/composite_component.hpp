@@ -24,6 +24,13 @@ public :
     /// \brief Constructor
     //* =====================================================================
     composite_component();
+
+    //* =====================================================================
+    /// \brief Lays out the underlying container, if necessary, so that the
+    /// positions and sizes of its components are current.
+    /// \see container::flush_layout
+    //* =====================================================================
+    void flush_layout();
     
 protected :
     //* =====================================================================
@@ -36,7 +43,7 @@ protected :
     //* =====================================================================
     void add_component(
         std::shared_ptr<component> const &comp,
-        boost::any const &hint = boost::any());
+        layout_hint const &hint = {});
     
     //* =====================================================================
     /// \brief Called by set_position().  Derived classes must override this
@@ -2,6 +2,7 @@
 
 #include "munin/export.hpp"
 #include "munin/component.hpp"
+#include "munin/layout_hint.hpp"
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -35,18 +36,44 @@ public :
     //* =====================================================================
     /// \brief Adds a component to the container.
     /// \param comp The component to add to the container
-    /// \param layout_hint A hint to be passed to the container's current
+    /// \param hint A hint to be passed to the container's current
     ///        layout.
     //* =====================================================================
     void add_component(
         std::shared_ptr<component> const &comp,
-        boost::any                 const &layout_hint = boost::any());
+        layout_hint                const &hint = {});
+
+    //* =====================================================================
+    /// \brief Adds several components to the container at once.  This is
+    /// equivalent to adding each in turn, except that the container is only
+    /// laid out, and only announces a change in preferred size, once.
+    /// \param comps The components to add to the container
+    /// \param hints The hints to be passed to the container's
+    ///        current layout for each component.  Any components without
+    ///        a corresponding hint are given an empty hint.
+    //* =====================================================================
+    void add_components(
+        std::vector<std::shared_ptr<component>> const &comps,
+        std::vector<layout_hint>                const &hints = {});
 
     //* =====================================================================
     /// \brief Removes a component from the container.
     //* =====================================================================
     void remove_component(std::shared_ptr<component> const &component);
 
+    //* =====================================================================
+    /// \brief Lays out the container's components if any change since the
+    /// last layout requires it.
+    /// \par
+    /// Changes to the container's size, layout or components do not lay
+    /// the container out immediately.  Instead, this happens when the
+    /// container next needs to know where its components are; for example,
+    /// when it is drawn, when it receives an event, or when the position or
+    /// size of one of its components is read.  Call this function in order
+    /// to perform any pending layout at a time of your choosing.
+    //* =====================================================================
+    void flush_layout();
+
 private :
     //* =====================================================================
     /// \brief Called by set_position().  Derived classes must override this
@@ -162,6 +189,12 @@ private :
     //* =====================================================================
     nlohmann::json do_to_json() const override;
 
+    //* =====================================================================
+    /// \brief Called before the position or size of a subcomponent is
+    /// read.  Performs any pending layout.
+    //* =====================================================================
+    void do_flush_layout() const override;
+
 private :
     struct impl;
     std::unique_ptr<impl> pimpl_;
@@ -3,7 +3,11 @@
 #include "munin/export.hpp"
 #include <terminalpp/rectangle.hpp>
 #include <boost/optional.hpp>
+#include <cstddef>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace terminalpp {
@@ -21,4 +25,39 @@ boost::optional<terminalpp::rectangle> intersection(
     terminalpp::rectangle const &lhs
   , terminalpp::rectangle const &rhs);
 
+//* =========================================================================
+/// \brief Moves the content of the given region of a canvas up by the 
+/// given number of rows, or down if the number is negative.  The rows that
+/// are exposed by the move keep their previous content.
+//* =========================================================================
+MUNIN_EXPORT
+void scroll_canvas(
+    terminalpp::canvas          &cvs,
+    terminalpp::rectangle const &region,
+    terminalpp::coordinate_type  rows);
+
+//* =========================================================================
+/// \brief Calls function(element, index) for each element of a tuple, in
+/// order.
+//* =========================================================================
+template <class Tuple, class Function, std::size_t... Indices>
+void for_each_in_tuple(
+    Tuple &&tuple, Function &&function, std::index_sequence<Indices...>)
+{
+    int const expansion[] = { 
+        0, (function(std::get<Indices>(tuple), Indices), 0)... 
+    };
+    (void)expansion;
+}
+
+template <class Tuple, class Function>
+void for_each_in_tuple(Tuple &&tuple, Function &&function)
+{
+    for_each_in_tuple(
+        std::forward<Tuple>(tuple),
+        std::forward<Function>(function),
+        std::make_index_sequence<
+            std::tuple_size<std::decay_t<Tuple>>::value>{});
+}
+
 }}
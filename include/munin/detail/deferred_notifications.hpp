@@ -0,0 +1,53 @@
+#pragma once
+
+#include "munin/export.hpp"
+#include <functional>
+
+namespace munin { namespace detail {
+
+//* =========================================================================
+/// \brief Begins deferring notifications on the current thread.  Calls may
+/// be nested.
+//* =========================================================================
+MUNIN_EXPORT
+void begin_deferring_notifications();
+
+//* =========================================================================
+/// \brief Ends deferring notifications on the current thread.  If this
+/// matches the outermost call to begin_deferring_notifications(), then all
+/// deferred notifications are announced, in the order in which they were
+/// deferred.
+//* =========================================================================
+MUNIN_EXPORT
+void end_deferring_notifications();
+
+//* =========================================================================
+/// \brief Returns true if notifications are being deferred on the current
+/// thread.
+//* =========================================================================
+MUNIN_EXPORT
+bool notifications_are_deferred();
+
+//* =========================================================================
+/// \brief Schedules a notification to be announced when notifications are
+/// no longer deferred.
+/// \param owner an object that identifies the owner of the notification,
+///        so that it may be cancelled.
+/// \par
+/// A notification that is deferred while other deferred notifications are 
+/// being announced is announced after them.  This allows notifications to
+/// cascade up the component hierarchy, gathering more notifications on the 
+/// way.
+//* =========================================================================
+MUNIN_EXPORT
+void defer_notification(
+    void const *owner, std::function<void ()> notification);
+
+//* =========================================================================
+/// \brief Cancels any deferred notifications of the given owner.  This must
+/// be called if the owner is destroyed.
+//* =========================================================================
+MUNIN_EXPORT
+void cancel_deferred_notifications(void const *owner);
+
+}}
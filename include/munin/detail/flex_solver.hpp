@@ -0,0 +1,194 @@
+#pragma once
+
+#include "munin/flex_track.hpp"
+#include <terminalpp/extent.hpp>
+#include <terminalpp/point.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace munin { namespace detail {
+
+//* =========================================================================
+/// \brief Returns the size of an extent along the main axis of a flex
+/// layout.
+//* =========================================================================
+inline terminalpp::coordinate_type main_axis(
+    terminalpp::extent const &size, flex_direction direction)
+{
+    return direction == flex_direction::row ? size.width : size.height;
+}
+
+//* =========================================================================
+/// \brief Returns the size of an extent across the main axis of a flex
+/// layout.
+//* =========================================================================
+inline terminalpp::coordinate_type cross_axis(
+    terminalpp::extent const &size, flex_direction direction)
+{
+    return direction == flex_direction::row ? size.height : size.width;
+}
+
+//* =========================================================================
+/// \brief Returns an extent from its sizes along and across the main axis
+/// of a flex layout.
+//* =========================================================================
+inline terminalpp::extent make_flex_extent(
+    terminalpp::coordinate_type main, 
+    terminalpp::coordinate_type cross,
+    flex_direction              direction)
+{
+    return direction == flex_direction::row
+         ? terminalpp::extent{main, cross}
+         : terminalpp::extent{cross, main};
+}
+
+//* =========================================================================
+/// \brief Returns a point from its co-ordinates along and across the main
+/// axis of a flex layout.
+//* =========================================================================
+inline terminalpp::point make_flex_point(
+    terminalpp::coordinate_type main, 
+    terminalpp::coordinate_type cross,
+    flex_direction              direction)
+{
+    return direction == flex_direction::row
+         ? terminalpp::point{main, cross}
+         : terminalpp::point{cross, main};
+}
+
+//* =========================================================================
+/// \brief Returns the size that a track would like to be, given the
+/// preferred size of its component along the main axis.
+//* =========================================================================
+inline terminalpp::coordinate_type preferred_track_size(
+    flex_track const &track, terminalpp::coordinate_type preferred_size)
+{
+    return track.basis == flex_basis::fixed
+         ? track.value
+         : (std::min)((std::max)(preferred_size, track.minimum), track.maximum);
+}
+
+//* =========================================================================
+/// \brief Returns the part of total that falls to a share that begins at
+/// "before" and is "part" long, out of shares that are "whole" long
+/// altogether.  Because each share is rounded at its cumulative
+/// boundaries, the parts always add up to exactly the total.
+//* =========================================================================
+inline terminalpp::coordinate_type proportion(
+    terminalpp::coordinate_type total,
+    std::int64_t                before,
+    std::int64_t                part,
+    std::int64_t                whole)
+{
+    return whole == 0
+         ? 0
+         : static_cast<terminalpp::coordinate_type>(
+               (total * (before + part)) / whole - (total * before) / whole);
+}
+
+//* =========================================================================
+/// \brief Solves the sizes of a series of flex tracks along a main axis of
+/// the given size, in two linear passes.
+/// \param track_at a function returning the flex_track of the track at 
+///        an index.
+/// \param preferred_at a function returning the preferred size along the
+///        main axis of the component in the track at an index.
+/// \param place a function that is called with the index, position and
+///        size of each track, in order.
+//* =========================================================================
+template <class TrackAt, class PreferredAt, class Place>
+void solve_flex_tracks(
+    std::size_t                 count,
+    terminalpp::coordinate_type main_size,
+    TrackAt                   &&track_at,
+    PreferredAt               &&preferred_at,
+    Place                     &&place)
+{
+    // The first pass measures the space that the tracks demand before any
+    // is shared out, how much of that the preferred tracks could give up,
+    // and the total weight of the weighted tracks.
+    auto demand       = terminalpp::coordinate_type{0};
+    auto shrinkable   = terminalpp::coordinate_type{0};
+    auto total_weight = terminalpp::coordinate_type{0};
+
+    for (auto index = std::size_t{0}; index < count; ++index)
+    {
+        flex_track const &track = track_at(index);
+
+        switch (track.basis)
+        {
+            case flex_basis::fixed :
+                demand += track.value;
+                break;
+
+            case flex_basis::preferred :
+            {
+                auto const size = 
+                    preferred_track_size(track, preferred_at(index));
+
+                demand     += size;
+                shrinkable += size - track.minimum;
+                break;
+            }
+
+            case flex_basis::weighted :
+                demand       += track.minimum;
+                total_weight += track.value;
+                break;
+        }
+    }
+
+    auto const free_space = (std::max)(main_size - demand, 0);
+    auto const shrinkage  = 
+        (std::min)((std::max)(demand - main_size, 0), shrinkable);
+
+    // The second pass shares out the free space, or the shrinkage, and
+    // places the tracks one after another.  Anything that still does not
+    // fit is truncated.
+    auto position      = terminalpp::coordinate_type{0};
+    auto weight_before = std::int64_t{0};
+    auto shrink_before = std::int64_t{0};
+
+    for (auto index = std::size_t{0}; index < count; ++index)
+    {
+        flex_track const &track = track_at(index);
+        auto size = terminalpp::coordinate_type{0};
+
+        switch (track.basis)
+        {
+            case flex_basis::fixed :
+                size = track.value;
+                break;
+
+            case flex_basis::preferred :
+            {
+                auto const preferred_size = 
+                    preferred_track_size(track, preferred_at(index));
+                auto const give = preferred_size - track.minimum;
+
+                size = preferred_size 
+                     - proportion(shrinkage, shrink_before, give, shrinkable);
+                shrink_before += give;
+                break;
+            }
+
+            case flex_basis::weighted :
+                size = (std::min)(
+                    track.minimum 
+                  + proportion(
+                        free_space, weight_before, track.value, total_weight),
+                    track.maximum);
+                weight_before += track.value;
+                break;
+        }
+
+        size = (std::max)((std::min)(size, main_size - position), 0);
+
+        place(index, position, size);
+
+        position += size;
+    }
+}
+
+}}
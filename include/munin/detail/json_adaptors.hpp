@@ -1,4 +1,5 @@
 #pragma once
+#include "munin/export.hpp"
 #include <nlohmann/json.hpp>
 
 namespace terminalpp {
@@ -11,8 +12,13 @@ namespace terminalpp {
 
 namespace munin { namespace detail {
 
+MUNIN_EXPORT
 nlohmann::json to_json(terminalpp::point const &pt);
+
+MUNIN_EXPORT
 nlohmann::json to_json(terminalpp::extent const &ext);
+
+MUNIN_EXPORT
 nlohmann::json to_json(terminalpp::element const &elem);
 
 }}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "munin/export.hpp"
+#include <terminalpp/rectangle.hpp>
+#include <vector>
+
+namespace munin { namespace detail {
+
+//* =========================================================================
+/// \brief A set of cells, stored as a minimal collection of disjoint
+/// rectangles.
+/// \par
+/// In the manner of X11 regions, the cells are stored as a sequence of
+/// horizontal bands.  Each band covers a contiguous run of rows, and holds
+/// a sorted sequence of non-overlapping spans of columns.  Adding a
+/// rectangle merges it with any area that it overlaps or abuts so that
+/// every cell in the region is described exactly once, and bands with
+/// identical spans that touch vertically are coalesced.
+//* =========================================================================
+class MUNIN_EXPORT region
+{
+public :
+    //* =====================================================================
+    /// \brief Adds the cells of the given rectangle to the region.
+    /// Rectangles with no area are ignored.
+    //* =====================================================================
+    void add(terminalpp::rectangle const &rect);
+
+    //* =====================================================================
+    /// \brief Removes the cells of the given rectangle from the region.
+    /// Rectangles with no area are ignored.
+    //* =====================================================================
+    void subtract(terminalpp::rectangle const &rect);
+
+    //* =====================================================================
+    /// \brief Adds to the region the cells that its contents within the
+    /// given area would occupy if that area were scrolled up by the given
+    /// number of rows, or down if the number is negative.  Cells that 
+    /// would be scrolled out of the area are dropped, and the cells 
+    /// already in the region are kept.
+    //* =====================================================================
+    void scroll(
+        terminalpp::rectangle const &area, terminalpp::coordinate_type rows);
+
+    //* =====================================================================
+    /// \brief Removes all cells from the region.
+    //* =====================================================================
+    void clear();
+
+    //* =====================================================================
+    /// \brief Returns true if the region contains no cells.
+    //* =====================================================================
+    bool empty() const;
+
+    //* =====================================================================
+    /// \brief Returns the region as a set of disjoint rectangles, ordered
+    /// from top to bottom and then from left to right.
+    //* =====================================================================
+    std::vector<terminalpp::rectangle> rectangles() const;
+
+private :
+    struct span
+    {
+        terminalpp::coordinate_type begin;
+        terminalpp::coordinate_type end;
+    };
+
+    struct band
+    {
+        terminalpp::coordinate_type top;
+        terminalpp::coordinate_type bottom;
+        std::vector<span> spans;
+    };
+
+    template <class SpanOperation>
+    void apply(terminalpp::rectangle const &rect, SpanOperation &&op);
+
+    std::vector<band> bands_;
+};
+
+}}
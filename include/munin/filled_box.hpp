@@ -60,6 +60,12 @@ protected :
         render_surface &surface,
         terminalpp::rectangle const &region) const override;
 
+    //* =====================================================================
+    /// \brief Called by is_opaque().  A filled box writes to every cell
+    /// that it is asked to draw, and so is always opaque.
+    //* =====================================================================
+    bool do_is_opaque() const override;
+
     //* =====================================================================
     /// \brief Called by to_json().  Derived classes must override this
     /// function in order to add additional data about their implementation
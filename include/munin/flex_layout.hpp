@@ -0,0 +1,81 @@
+#pragma once
+
+#include "munin/flex_track.hpp"
+#include "munin/layout.hpp"
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A class that knows how to lay components out in a container in
+/// a single row or column of tracks.  Each component is given the whole
+/// of the container across the main axis, and a track along it that is
+/// described by a flex_track hint:
+///
+///   * a fixed track is always the given size.
+///   * a preferred track is the preferred size of its component.
+///   * a weighted track shares the space left by the other tracks with
+///     the other weighted tracks in proportion to its weight.
+///
+/// Components without a flex_track hint are given preferred tracks.  All
+/// tracks respect their minimum and maximum sizes, although space that a
+/// weighted track cannot take because of its maximum is left unused.  If
+/// there is not enough space for every track, the preferred tracks shrink
+/// towards their minimums, and then tracks are truncated in the order in
+/// which they were added.  The layout is solved in linear time.
+///
+/// \verbatim
+/// +--------------------------+
+/// |+-++-------++------------+|
+/// || ||       ||            ||  row: fixed, preferred and weighted tracks
+/// || ||       ||            ||
+/// |+-++-------++------------+|
+/// +--------------------------+
+/// \endverbatim
+//* =========================================================================
+class MUNIN_EXPORT flex_layout final
+    : public layout
+{
+public :
+    //* =====================================================================
+    /// \brief Constructor
+    //* =====================================================================
+    explicit flex_layout(flex_direction direction);
+
+protected :
+    //* =====================================================================
+    /// \brief Called by get_preferred_size().  Derived classes must override
+    /// this function in order to retrieve the preferred size of the layout
+    /// in a custom manner.
+    //* =====================================================================
+    terminalpp::extent do_get_preferred_size(
+        std::vector<std::shared_ptr<component>> const &components,
+        std::vector<layout_hint>                const &hints) const override;
+
+    //* =====================================================================
+    /// \brief Called by operator().  Derived classes must override this
+    /// function in order to lay a container's components out in a custom
+    /// manner.
+    //* =====================================================================
+    void do_layout(
+        std::vector<std::shared_ptr<component>> const &components,
+        std::vector<layout_hint>                const &hints,
+        terminalpp::extent                             size) const override;
+
+    //* =====================================================================
+    /// \brief Called by to_json().  Derived classes must override this
+    /// function in order to add additional data about their implementation
+    /// in a custom manner.
+    //* =====================================================================
+    nlohmann::json do_to_json() const override;
+
+private :
+    flex_direction direction_;
+};
+
+//* =========================================================================
+/// \brief Returns a newly created flex layout
+//* =========================================================================
+MUNIN_EXPORT
+std::unique_ptr<layout> make_flex_layout(flex_direction direction);
+
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <terminalpp/extent.hpp>
+#include <limits>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief The axis along which a flex layout places its components.
+//* =========================================================================
+enum class flex_direction
+{
+    row,
+    column,
+};
+
+//* =========================================================================
+/// \brief How a flex_layout decides the size of a track.
+//* =========================================================================
+enum class flex_basis
+{
+    fixed,
+    preferred,
+    weighted,
+};
+
+//* =========================================================================
+/// \brief A hint for a flex_layout about how much of the layout's main axis
+/// to give to the component.
+//* =========================================================================
+struct flex_track
+{
+    //* =====================================================================
+    /// \brief How the size of the track is decided.
+    //* =====================================================================
+    flex_basis basis;
+
+    //* =====================================================================
+    /// \brief For fixed tracks, the size of the track.  For weighted
+    /// tracks, its share of the space left over by the other tracks.
+    //* =====================================================================
+    terminalpp::coordinate_type value;
+
+    //* =====================================================================
+    /// \brief The smallest size the track may be given while there is room
+    /// for it.
+    //* =====================================================================
+    terminalpp::coordinate_type minimum;
+
+    //* =====================================================================
+    /// \brief The largest size the track may be given.
+    //* =====================================================================
+    terminalpp::coordinate_type maximum;
+};
+
+static constexpr terminalpp::coordinate_type const flex_unbounded =
+    (std::numeric_limits<terminalpp::coordinate_type>::max)();
+
+//* =========================================================================
+/// \brief Returns a track that is always the given size.
+//* =========================================================================
+constexpr flex_track fixed_track(terminalpp::coordinate_type size)
+{
+    return { flex_basis::fixed, size, size, size };
+}
+
+//* =========================================================================
+/// \brief Returns a track that is the preferred size of its component,
+/// within the given bounds.
+//* =========================================================================
+constexpr flex_track preferred_track(
+    terminalpp::coordinate_type minimum = 0,
+    terminalpp::coordinate_type maximum = flex_unbounded)
+{
+    return { flex_basis::preferred, 0, minimum, maximum };
+}
+
+//* =========================================================================
+/// \brief Returns a track that takes a share of the remaining space in
+/// proportion to its weight, within the given bounds.
+//* =========================================================================
+constexpr flex_track weighted_track(
+    terminalpp::coordinate_type weight = 1,
+    terminalpp::coordinate_type minimum = 0,
+    terminalpp::coordinate_type maximum = flex_unbounded)
+{
+    return { flex_basis::weighted, weight, minimum, maximum };
+}
+
+}
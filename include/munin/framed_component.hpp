@@ -20,6 +20,13 @@ public :
         std::shared_ptr<component> inner_component);
 
 protected :
+    //* =====================================================================
+    /// \brief Called by set_size().  A framed component is laid out as
+    /// soon as it is resized, since placing the frame and the inner
+    /// component is cheap, and both of them defer their own layouts.
+    //* =====================================================================
+    void do_set_size(terminalpp::extent const &size) override;
+
     //* =====================================================================
     /// \brief Called by event().  Derived classes must override this
     /// function in order to handle events in a custom manner.
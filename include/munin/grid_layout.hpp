@@ -39,7 +39,7 @@ protected :
     //* =====================================================================
     terminalpp::extent do_get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const override;
+        std::vector<layout_hint>                const &hints) const override;
 
     //* =====================================================================
     /// \brief Called by operator().  Derived classes must override this
@@ -48,7 +48,7 @@ protected :
     //* =====================================================================
     void do_layout(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const override;
 
     //* =====================================================================
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "munin/export.hpp"
+#include "munin/layout_hint.hpp"
 #include <terminalpp/extent.hpp>
 #include <nlohmann/json.hpp>
-#include <boost/any.hpp>
 #include <memory>
 #include <vector>
 
@@ -31,7 +31,7 @@ public :
     //* =====================================================================
     terminalpp::extent get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const;
+        std::vector<layout_hint>                const &hints) const;
 
     //* =====================================================================
     /// \brief Performs a layout of the specified components within the
@@ -39,7 +39,7 @@ public :
     //* =====================================================================
     void operator()(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const;
 
     //* =====================================================================
@@ -60,7 +60,7 @@ protected :
     //* =====================================================================
     virtual terminalpp::extent do_get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const = 0;
+        std::vector<layout_hint>                const &hints) const = 0;
 
     //* =====================================================================
     /// \brief Called by operator().  Derived classes must override this
@@ -69,7 +69,7 @@ protected :
     //* =====================================================================
     virtual void do_layout(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const = 0;
 
     //* =====================================================================
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "munin/alignment.hpp"
+#include "munin/compass_heading.hpp"
+#include "munin/flex_track.hpp"
+#include <boost/any.hpp>
+#include <boost/blank.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/variant/variant.hpp>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A hint passed to a layout about how to arrange a component.
+/// \par
+/// The hints understood by the layouts in this library are held inline,
+/// so that storing and inspecting them neither allocates nor consults
+/// RTTI.  Any other value is held in a boost::any for the benefit of
+/// custom layouts, which may retrieve it with 
+/// boost::get<boost::any>().  An empty hint holds boost::blank.
+//* =========================================================================
+using layout_hint = boost::variant<
+    boost::blank,
+    alignment,
+    compass_heading,
+    flex_track,
+    boost::any
+>;
+
+}
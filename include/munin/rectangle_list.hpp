@@ -0,0 +1,16 @@
+#pragma once
+
+#include <terminalpp/rectangle.hpp>
+#include <boost/container/small_vector.hpp>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A list of rectangles, such as the regions of a component that
+/// require redrawing.  The first few rectangles are stored within the list
+/// itself, so announcing a handful of regions does not allocate memory.
+//* =========================================================================
+using rectangle_list = 
+    boost::container::small_vector<terminalpp::rectangle, 4>;
+
+}
@@ -3,6 +3,9 @@
 #include "munin/export.hpp"
 #include "munin/render_surface_capabilities.hpp"
 #include <terminalpp/canvas.hpp>
+#include <terminalpp/rectangle.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace munin {
 
@@ -40,6 +43,40 @@ public :
         terminalpp::coordinate_type column_;
     };
 
+    //* =====================================================================
+    /// \brief An RAII object that, for its lifetime, moves the basis of a
+    /// render surface to the origin of a given region and restricts all
+    /// writes to the surface to that region.
+    /// \par
+    /// The region is specified relative to the current basis of the surface,
+    /// and is intersected with any clip region already in force.  Writes
+    /// outside of the clip region are discarded.  The previous basis and 
+    /// clip region are restored on destruction.
+    //* =====================================================================
+    class MUNIN_EXPORT scoped_clip
+    {
+    public :
+        // ==================================================================
+        // CONSTRUCTOR
+        // ==================================================================
+        scoped_clip(
+            render_surface &surface,
+            terminalpp::rectangle const &region);
+
+        // ==================================================================
+        // DESTRUCTOR
+        // ==================================================================
+        ~scoped_clip();
+
+        scoped_clip(scoped_clip const &) = delete;
+        scoped_clip &operator=(scoped_clip const &) = delete;
+
+    private :
+        render_surface &surface_;
+        terminalpp::extent previous_offset_;
+        terminalpp::rectangle previous_clip_;
+    };
+
     //* =====================================================================
     /// \brief Constructor
     //* =====================================================================
@@ -70,12 +107,83 @@ public :
     //* =====================================================================
     terminalpp::extent size() const;
 
+    //* =====================================================================
+    /// \brief Returns the region of the surface that may be written to,
+    /// relative to its current basis.  Components may use this to avoid
+    /// drawing elements that would be discarded.
+    //* =====================================================================
+    terminalpp::rectangle clip_region() const;
+
     //* =====================================================================
     /// \brief A subscript operator into a column
     //* =====================================================================
     column_proxy operator[](terminalpp::coordinate_type column);
 
+    //* =====================================================================
+    /// \brief Sets a horizontal run of elements, beginning at the given
+    /// origin, to the given value.
+    //* =====================================================================
+    void fill_row(
+        terminalpp::point const &origin,
+        terminalpp::coordinate_type width,
+        terminalpp::element const &value);
+
+    //* =====================================================================
+    /// \brief Copies a sequence of elements into a horizontal run, 
+    /// beginning at the given origin.
+    //* =====================================================================
+    template <class ForwardIterator>
+    void write_row(
+        terminalpp::point const &origin,
+        ForwardIterator first,
+        ForwardIterator last);
+
+    //* =====================================================================
+    /// \brief Sets every element within the given region to the given
+    /// value.
+    //* =====================================================================
+    void fill_rect(
+        terminalpp::rectangle const &region,
+        terminalpp::element const &value);
+
+    //* =====================================================================
+    /// \brief Begins recording which elements of the canvas are changed by
+    /// writes to the surface.
+    /// \par
+    /// Writes made through fill_row, write_row and fill_rect compare each
+    /// element before writing, and only record elements whose value
+    /// actually changes.  Since an element obtained through the subscript 
+    /// operator may be written in any way, it is always recorded as 
+    /// changed.
+    //* =====================================================================
+    void track_changes();
+
+    //* =====================================================================
+    /// \brief Returns, for each row of the canvas that contains changed
+    /// elements, a single-row region that spans those changes.  The
+    /// regions are in the co-ordinates of the canvas, not the current basis
+    /// of the surface.
+    //* =====================================================================
+    std::vector<terminalpp::rectangle> changed_regions() const;
+
 private :
+    //* =====================================================================
+    /// \brief Writes an element to the underlying canvas, recording the
+    /// change if necessary.  The co-ordinates are those of the canvas.
+    //* =====================================================================
+    void write_element(
+        terminalpp::coordinate_type column,
+        terminalpp::coordinate_type row,
+        terminalpp::element const &value);
+
+    //* =====================================================================
+    /// \brief Records that an element of the underlying canvas has 
+    /// changed.  The co-ordinates are those of the canvas.
+    //* =====================================================================
+    void mark_changed(
+        terminalpp::coordinate_type column,
+        terminalpp::coordinate_type row);
+
     //* =====================================================================
     /// \brief Gets an element from the underlying canvas.
     //* =====================================================================
@@ -86,6 +194,94 @@ private :
     render_surface_capabilities const &capabilities_;
     terminalpp::canvas &canvas_;
     terminalpp::extent  offset_;
+    
+    // The clip region is stored in the co-ordinates of the canvas.
+    terminalpp::rectangle clip_;
+    
+    // Writes outside of the clip region are directed to this element.
+    terminalpp::element discarded_element_;
+
+    // When tracking changes, each row of the canvas has a half-open range
+    // of columns that spans the changes made to it.
+    struct changed_columns
+    {
+        terminalpp::coordinate_type begin;
+        terminalpp::coordinate_type end;
+    };
+
+    bool tracking_changes_ = false;
+    std::vector<changed_columns> changes_;
 };
 
+// ==========================================================================
+// MARK_CHANGED
+// ==========================================================================
+inline void render_surface::mark_changed(
+    terminalpp::coordinate_type column,
+    terminalpp::coordinate_type row)
+{
+    auto &changed = changes_[row];
+
+    if (changed.begin >= changed.end)
+    {
+        changed = {column, column + 1};
+    }
+    else
+    {
+        changed.begin = (std::min)(changed.begin, column);
+        changed.end   = (std::max)(changed.end, column + 1);
+    }
+}
+
+// ==========================================================================
+// WRITE_ELEMENT
+// ==========================================================================
+inline void render_surface::write_element(
+    terminalpp::coordinate_type column,
+    terminalpp::coordinate_type row,
+    terminalpp::element const &value)
+{
+    auto &elem = canvas_[column][row];
+
+    if (tracking_changes_)
+    {
+        if (elem == value)
+        {
+            return;
+        }
+
+        mark_changed(column, row);
+    }
+
+    elem = value;
+}
+
+// ==========================================================================
+// WRITE_ROW
+// ==========================================================================
+template <class ForwardIterator>
+void render_surface::write_row(
+    terminalpp::point const &origin,
+    ForwardIterator first,
+    ForwardIterator last)
+{
+    auto const row = origin.y + offset_.height;
+    auto column = origin.x + offset_.width;
+    auto const clip_left  = clip_.origin.x;
+    auto const clip_right = clip_.origin.x + clip_.size.width;
+
+    if (row < clip_.origin.y || row >= clip_.origin.y + clip_.size.height)
+    {
+        return;
+    }
+
+    for (; first != last && column < clip_right; ++first, ++column)
+    {
+        if (column >= clip_left)
+        {
+            write_element(column, row, *first);
+        }
+    }
+}
+
 }
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "munin/export.hpp"
+#include <boost/optional.hpp>
+#include <boost/signals2/signal.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace munin {
+
+class window;
+
+//* =========================================================================
+/// \brief An object that throttles the repainting of a set of windows.
+/// \par
+/// Each window that is added to the scheduler has its repaint requests
+/// collected, and is painted at most once per frame interval.  A request
+/// is never delayed by more than one frame interval: a window that has not
+/// been painted for at least that long is painted as soon as it asks,
+/// otherwise it is painted as soon as the interval since its last paint has
+/// elapsed.  Any requests that arrive in the meantime are folded into that
+/// single paint.
+/// \par
+/// The scheduler owns no timers.  Instead, it announces through 
+/// on_repaint_scheduled when a window becomes due for painting, and it is 
+/// up to the caller to arrange to call poll() at (or after) that time.
+//* =========================================================================
+class MUNIN_EXPORT repaint_scheduler
+{
+public :
+    using clock_type = std::chrono::steady_clock;
+    using time_point = clock_type::time_point;
+    using duration   = clock_type::duration;
+
+    //* =====================================================================
+    /// \brief Constructor
+    /// \param frame_interval the minimum time between two paints of the
+    ///        same window.  For example, std::chrono::seconds(1) / 30 
+    ///        limits each window to 30 paints per second.
+    /// \param clock a function that returns the current time.  This may
+    ///        be replaced in order to control the passage of time.
+    //* =====================================================================
+    explicit repaint_scheduler(
+        duration frame_interval,
+        std::function<time_point ()> clock = &clock_type::now);
+
+    //* =====================================================================
+    /// \brief Destructor
+    //* =====================================================================
+    ~repaint_scheduler();
+
+    //* =====================================================================
+    /// \brief Adds a window to the scheduler.  If the window has already
+    /// requested a repaint, then that repaint is scheduled straight away.
+    /// \param wnd the window whose repaint requests are to be throttled.
+    ///        It must outlive its membership of the scheduler.
+    /// \param paint a function that is called when the window is due to be
+    ///        painted.  It is expected to call one of the window's repaint
+    ///        functions and send the result to its terminal.
+    //* =====================================================================
+    void add_window(window &wnd, std::function<void ()> paint);
+
+    //* =====================================================================
+    /// \brief Removes a window from the scheduler.  Any pending paint for
+    /// that window is discarded.
+    //* =====================================================================
+    void remove_window(window &wnd);
+
+    //* =====================================================================
+    /// \brief Paints each window whose paint is due.
+    //* =====================================================================
+    void poll();
+
+    //* =====================================================================
+    /// \brief Returns the earliest time at which a window is due to be
+    /// painted, or an empty optional if no window requires painting.
+    //* =====================================================================
+    boost::optional<time_point> next_deadline() const;
+
+    //* =====================================================================
+    /// \fn on_repaint_scheduled
+    /// \brief Connect to this signal in order to receive notifications that
+    /// a window has requested a repaint and will be due for painting at
+    /// the given time.
+    //* =====================================================================
+    boost::signals2::signal
+    <
+        void (time_point)
+    > on_repaint_scheduled;
+
+private :
+    struct impl;
+    std::unique_ptr<impl> pimpl_;
+};
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "munin/text_area.hpp"
+#include "munin/virtual_content.hpp"
+#include <memory>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A text area whose text wraps at its width and which provides 
+/// virtual content, so that a viewport onto a long log or scrollback need
+/// only lay out and draw the part of it that is shown.
+/// \par
+/// Unlike a plain text area in a viewport, long lines are wrapped rather
+/// than scrolled horizontally, since the width of the content is always
+/// the width of the viewport.
+//* =========================================================================
+class MUNIN_EXPORT scrollback 
+  : public text_area,
+    public virtual_content
+{
+protected:
+    //* =====================================================================
+    /// \brief Called by get_content_extent().  Derived classes must 
+    /// override this function in order to return the extent of their 
+    /// content.
+    //* =====================================================================
+    terminalpp::extent do_get_content_extent() const override;
+};
+
+//* =========================================================================
+/// \brief Returns a newly created empty scrollback.
+//* =========================================================================
+MUNIN_EXPORT
+std::shared_ptr<scrollback> make_scrollback();
+
+}
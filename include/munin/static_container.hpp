@@ -0,0 +1,825 @@
+#pragma once
+
+#include "munin/component.hpp"
+#include "munin/render_surface.hpp"
+#include "munin/detail/algorithm.hpp"
+#include "munin/detail/json_adaptors.hpp"
+#include "munin/detail/region.hpp"
+#include <terminalpp/ansi/mouse.hpp>
+#include <terminalpp/rectangle.hpp>
+#include <boost/optional.hpp>
+#include <boost/scope_exit.hpp>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A container for a set of components whose types and number are
+/// known at compile time.
+/// \par
+/// Unlike container, which holds its subcomponents in a vector of shared
+/// pointers and lays them out using a polymorphic layout and type-erased
+/// hints, a static_container holds its subcomponents by value in a tuple
+/// and lays them out with a layout policy that is part of its type.  
+/// Drawing and layout walk the tuple, and so call the subcomponents 
+/// through their concrete types, with no separate allocation for each 
+/// one.  Focus, cursor, event and JSON handling go through the component
+/// interface of each subcomponent, just as in container.  The 
+/// subcomponents' signals are connected just as in container, too, 
+/// except that each handler knows the index of its subcomponent without 
+/// having to look it up.  It is still a component, and so may be used 
+/// anywhere that a container is.
+/// \par
+/// The Layout policy must provide:
+///
+///   * terminalpp::extent get_preferred_size(
+///         std::tuple<Components...> const &) const
+///   * void operator()(std::tuple<Components...> &, terminalpp::extent) const
+///   * nlohmann::json to_json() const
+///
+/// static_flex_layout is such a policy.  As with container, layout is 
+/// deferred until the container is next drawn or the position or size of
+/// a subcomponent is next read, so that a series of changes costs only one
+/// layout.
+//* =========================================================================
+template <class Layout, class... Components>
+class static_container final
+    : public component
+{
+public :
+    //* =====================================================================
+    /// \brief Constructor.  Each subcomponent is default-constructed.
+    //* =====================================================================
+    explicit static_container(Layout layout)
+      : layout_(std::move(layout))
+    {
+        connect_components();
+    }
+
+    //* =====================================================================
+    /// \brief Constructor.  Each subcomponent is constructed in place from
+    /// the corresponding argument.
+    //* =====================================================================
+    template <
+        class... Args,
+        class = std::enable_if_t<
+            sizeof...(Args) == sizeof...(Components) 
+         && sizeof...(Args) != 0>
+    >
+    static_container(Layout layout, Args &&...args)
+      : layout_(std::move(layout)),
+        components_(std::forward<Args>(args)...)
+    {
+        connect_components();
+    }
+
+    // The subcomponents' signals are connected to handlers that refer to 
+    // this container, and so it may be neither copied nor moved.
+    static_container(static_container const &) = delete;
+    static_container &operator=(static_container const &) = delete;
+
+    //* =====================================================================
+    /// \brief Returns the subcomponent at the given index.
+    //* =====================================================================
+    template <std::size_t Index>
+    auto &get()
+    {
+        return std::get<Index>(components_);
+    }
+
+    //* =====================================================================
+    /// \brief Returns the subcomponent at the given index.
+    //* =====================================================================
+    template <std::size_t Index>
+    auto const &get() const
+    {
+        return std::get<Index>(components_);
+    }
+
+protected :
+    //* =====================================================================
+    /// \brief Called by set_position().  Derived classes must override this
+    /// function in order to set the position of the component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_position(terminalpp::point const &position) override
+    {
+        bounds_.origin = position;
+    }
+
+    //* =====================================================================
+    /// \brief Called by get_position().  Derived classes must override this
+    /// function in order to get the position of the component in a custom
+    /// manner.
+    //* =====================================================================
+    terminalpp::point do_get_position() const override
+    {
+        return bounds_.origin;
+    }
+
+    //* =====================================================================
+    /// \brief Called by set_size().  Derived classes must override this
+    /// function in order to set the size of the component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_size(terminalpp::extent const &size) override
+    {
+        if (size != bounds_.size)
+        {
+            bounds_.size = size;
+            invalidate_layout();
+        }
+    }
+
+    //* =====================================================================
+    /// \brief Called by get_size().  Derived classes must override this
+    /// function in order to get the size of the component in a custom
+    /// manner.
+    //* =====================================================================
+    terminalpp::extent do_get_size() const override
+    {
+        return bounds_.size;
+    }
+
+    //* =====================================================================
+    /// \brief Called by get_preferred_size().  Derived classes must override
+    /// this function in order to get the preferred size of the component in
+    /// a custom manner.
+    //* =====================================================================
+    terminalpp::extent do_get_preferred_size() const override
+    {
+        return layout_.get_preferred_size(components_);
+    }
+
+    //* =====================================================================
+    /// \brief Called by has_focus().  Derived classes must override this
+    /// function in order to return whether this component has focus in a
+    /// custom manner.
+    //* =====================================================================
+    bool do_has_focus() const override
+    {
+        return has_focus_;
+    }
+
+    //* =====================================================================
+    /// \brief Called by set_focus().  Derived classes must override this
+    /// function in order to set the focus to this component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_focus() override
+    {
+        if (has_focus_)
+        {
+            return;
+        }
+
+        in_focus_operation_ = true;
+
+        BOOST_SCOPE_EXIT_ALL(this)
+        {
+            in_focus_operation_ = false;
+        };
+
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            children_[index]->set_focus();
+
+            if (children_[index]->has_focus())
+            {
+                focussed_index_ = index;
+                has_focus_ = true;
+
+                on_focus_set();
+                on_cursor_state_changed();
+                on_cursor_position_changed();
+                break;
+            }
+        }
+    }
+
+    //* =====================================================================
+    /// \brief Called by lose_focus().  Derived classes must override this
+    /// function in order to lose the focus from this component in a
+    /// custom manner.
+    //* =====================================================================
+    void do_lose_focus() override
+    {
+        if (!focussed_index_)
+        {
+            return;
+        }
+
+        in_focus_operation_ = true;
+
+        BOOST_SCOPE_EXIT_ALL(this)
+        {
+            in_focus_operation_ = false;
+        };
+
+        children_[*focussed_index_]->lose_focus();
+        focussed_index_ = boost::none;
+        has_focus_ = false;
+
+        on_focus_lost();
+        on_cursor_state_changed();
+        on_cursor_position_changed();
+    }
+
+    //* =====================================================================
+    /// \brief Called by focus_next().  Derived classes must override this
+    /// function in order to move the focus in a custom manner.
+    //* =====================================================================
+    void do_focus_next() override
+    {
+        focus_incremental(
+            [](std::size_t index) { return index; },
+            [](component &comp) { comp.focus_next(); });
+    }
+
+    //* =====================================================================
+    /// \brief Called by focus_previous().  Derived classes must override 
+    /// this function in order to move the focus in a custom manner.
+    //* =====================================================================
+    void do_focus_previous() override
+    {
+        focus_incremental(
+            [](std::size_t index) { return count - index - 1; },
+            [](component &comp) { comp.focus_previous(); });
+    }
+
+    //* =====================================================================
+    /// \brief Called by get_cursor_state().  Derived classes must override
+    /// this function in order to return the cursor state in a custom
+    /// manner.
+    //* =====================================================================
+    bool do_get_cursor_state() const override
+    {
+        return focussed_index_
+            && children_[*focussed_index_]->get_cursor_state();
+    }
+
+    //* =====================================================================
+    /// \brief Called by get_cursor_position().  Derived classes must 
+    /// override this function in order to return the cursor position in
+    /// a custom manner.
+    //* =====================================================================
+    terminalpp::point do_get_cursor_position() const override
+    {
+        if (!focussed_index_)
+        {
+            return {};
+        }
+
+        auto const &comp = *children_[*focussed_index_];
+        return comp.get_position() + comp.get_cursor_position();
+    }
+
+    //* =====================================================================
+    /// \brief Called by set_cursor_position().  Derived classes must 
+    /// override this function in order to set the cursor position in a
+    /// custom manner.
+    //* =====================================================================
+    void do_set_cursor_position(terminalpp::point const &position) override
+    {
+        if (focussed_index_)
+        {
+            auto &comp = *children_[*focussed_index_];
+            comp.set_cursor_position(position - comp.get_position());
+        }
+    }
+
+    //* =====================================================================
+    /// \brief Called by draw().  Derived classes must override this function
+    /// in order to draw onto the passed context.  A component must only draw
+    /// the part of itself specified by the region.
+    //* =====================================================================
+    void do_draw(
+        render_surface              &surface,
+        terminalpp::rectangle const &region) const override
+    {
+        flush_layout();
+
+        detail::for_each_in_tuple(
+            components_,
+            [&surface, &region](auto const &comp, std::size_t)
+            {
+                auto const component_region = terminalpp::rectangle{
+                    comp.get_position(), comp.get_size()
+                };
+
+                auto draw_region = 
+                    detail::intersection(component_region, region);
+
+                if (draw_region)
+                {
+                    draw_region->origin -= component_region.origin;
+
+                    render_surface::scoped_clip const clip(
+                        surface, component_region);
+
+                    comp.draw(surface, *draw_region);
+                }
+            });
+    }
+
+    //* =====================================================================
+    /// \brief Called by event().  Derived classes must override this
+    /// function in order to handle events in a custom manner.
+    //* =====================================================================
+    void do_event(boost::any const &ev) override
+    {
+        // As with container, mouse events are passed to the subcomponent
+        // at the location of the event, relative to its origin, and all 
+        // other events are passed to the focussed subcomponent.
+        auto const *report = 
+            boost::any_cast<terminalpp::ansi::mouse::report>(&ev);
+
+        if (report == nullptr)
+        {
+            if (focussed_index_)
+            {
+                children_[*focussed_index_]->event(ev);
+            }
+
+            return;
+        }
+
+        auto const location = 
+            terminalpp::point(report->x_position_, report->y_position_);
+
+        flush_layout();
+
+        for (auto *comp : children_)
+        {
+            auto const position = comp->get_position();
+            auto const size     = comp->get_size();
+
+            if (location.x >= position.x
+             && location.x <  position.x + size.width
+             && location.y >= position.y
+             && location.y <  position.y + size.height)
+            {
+                comp->event(
+                    terminalpp::ansi::mouse::report {
+                        report->button_,
+                        report->x_position_ - position.x,
+                        report->y_position_ - position.y
+                    });
+                break;
+            }
+        }
+    }
+
+    //* =====================================================================
+    /// \brief Called by to_json().  Derived classes must override this
+    /// function in order to add additional data about their implementation
+    /// in a custom manner.
+    //* =====================================================================
+    nlohmann::json do_to_json() const override
+    {
+        flush_layout();
+
+        nlohmann::json json = {
+            { "type",            "static_container" },
+            { "position",        detail::to_json(get_position()) },
+            { "size",            detail::to_json(get_size()) },
+            { "preferred_size",  detail::to_json(get_preferred_size()) },
+            { "has_focus",       has_focus() },
+            { "cursor_state",    get_cursor_state() },
+            { "cursor_position", detail::to_json(get_cursor_position()) },
+            { "layout",          layout_.to_json() },
+        };
+
+        auto &subcomponents = json["subcomponents"];
+
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            subcomponents[index] = children_[index]->to_json();
+        }
+
+        return json;
+    }
+
+    //* =====================================================================
+    /// \brief Called before the position or size of a subcomponent is
+    /// read.  Performs any pending layout.
+    //* =====================================================================
+    void do_flush_layout() const override
+    {
+        flush_layout();
+    }
+
+private :
+    static constexpr std::size_t count = sizeof...(Components);
+
+    // ======================================================================
+    // CONNECT_COMPONENTS
+    // ======================================================================
+    void connect_components()
+    {
+        // The subcomponents are members of this container, so the 
+        // connections are broken when they are destroyed along with it and
+        // need not be tracked.
+        connect_components(std::make_index_sequence<count>{});
+    }
+
+    template <std::size_t... Indices>
+    void connect_components(std::index_sequence<Indices...>)
+    {
+        int const expansion[] = { 0, (connect_component<Indices>(), 0)... };
+        (void)expansion;
+    }
+
+    // ======================================================================
+    // CONNECT_COMPONENT
+    // ======================================================================
+    template <std::size_t Index>
+    void connect_component()
+    {
+        auto &comp = std::get<Index>(components_);
+        children_[Index] = &comp;
+        set_layout_owner(comp, *this);
+
+        comp.on_redraw.connect(
+            [this](rectangle_list const &regions)
+            {
+                this->subcomponent_redraw_handler(Index, regions);
+            });
+
+        comp.on_scroll.connect(
+            [this](
+                terminalpp::rectangle const &region, 
+                terminalpp::coordinate_type  rows)
+            {
+                return this->subcomponent_scroll_handler(Index, region, rows);
+            });
+
+        comp.on_preferred_size_changed.connect(
+            [this]
+            {
+                // Nothing is announced until the layout is flushed, when
+                // only the subcomponents that it moves are redrawn.
+                layout_dirty_ = true;
+                on_preferred_size_changed();
+            });
+
+        comp.on_focus_set.connect(
+            [this]
+            {
+                this->subcomponent_focus_set_handler(Index);
+            });
+
+        comp.on_focus_lost.connect(
+            [this]
+            {
+                this->subcomponent_focus_lost_handler(Index);
+            });
+
+        comp.on_cursor_state_changed.connect(
+            [this]
+            {
+                if (focussed_index_ == Index)
+                {
+                    on_cursor_state_changed();
+                }
+            });
+
+        comp.on_cursor_position_changed.connect(
+            [this]
+            {
+                if (focussed_index_ == Index)
+                {
+                    on_cursor_position_changed();
+                }
+            });
+    }
+
+    // ======================================================================
+    // INVALIDATE_LAYOUT
+    // ======================================================================
+    void invalidate_layout()
+    {
+        // The container has been resized, so the whole of it is announced
+        // as needing a redraw, and the layout itself is left until it is
+        // needed.
+        layout_dirty_ = true;
+
+        if (bounds_.size.width > 0 && bounds_.size.height > 0)
+        {
+            layout_redraw_announced_ = true;
+            on_redraw({{{}, bounds_.size}});
+        }
+    }
+
+    // ======================================================================
+    // FLUSH_LAYOUT
+    // ======================================================================
+    void flush_layout() const
+    {
+        if (in_layout_ || !std::exchange(layout_dirty_, false))
+        {
+            return;
+        }
+
+        auto const announce_changes = 
+            !std::exchange(layout_redraw_announced_, false);
+        std::array<terminalpp::rectangle, count> old_bounds;
+
+        if (announce_changes)
+        {
+            for (auto index = std::size_t{0}; index < count; ++index)
+            {
+                old_bounds[index] = {
+                    children_[index]->get_position(), 
+                    children_[index]->get_size()
+                };
+            }
+        }
+
+        {
+            // Subcomponents being moved and resized may request redraws,
+            // but whatever the layout changes is announced afterwards, so
+            // these add nothing.
+            in_layout_ = true;
+
+            BOOST_SCOPE_EXIT_ALL(this)
+            {
+                in_layout_ = false;
+            };
+
+            layout_(components_, bounds_.size);
+        }
+
+        if (announce_changes)
+        {
+            announce_layout_changes(old_bounds);
+        }
+    }
+
+    // ======================================================================
+    // ANNOUNCE_LAYOUT_CHANGES
+    // ======================================================================
+    void announce_layout_changes(
+        std::array<terminalpp::rectangle, count> const &old_bounds) const
+    {
+        auto const container_bounds = terminalpp::rectangle{{}, bounds_.size};
+        detail::region changed_region;
+
+        auto const add_visible_part = 
+            [&](terminalpp::rectangle const &rect)
+            {
+                auto const visible = 
+                    detail::intersection(rect, container_bounds);
+
+                if (visible)
+                {
+                    changed_region.add(*visible);
+                }
+            };
+
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            auto const new_bounds = terminalpp::rectangle{
+                children_[index]->get_position(), 
+                children_[index]->get_size()
+            };
+
+            if (new_bounds != old_bounds[index])
+            {
+                add_visible_part(old_bounds[index]);
+                add_visible_part(new_bounds);
+            }
+        }
+
+        if (!changed_region.empty())
+        {
+            auto const regions = changed_region.rectangles();
+            on_redraw(rectangle_list(regions.begin(), regions.end()));
+        }
+    }
+
+    // ======================================================================
+    // SUBCOMPONENT_REDRAW_HANDLER
+    // ======================================================================
+    void subcomponent_redraw_handler(
+        std::size_t index, rectangle_list regions)
+    {
+        if (in_layout_)
+        {
+            return;
+        }
+
+        // Regions are rebound to the origin of this container and clipped
+        // to the part of it that the subcomponent covers.
+        auto const origin = children_[index]->get_position();
+        auto const visible_region = detail::intersection(
+            terminalpp::rectangle{origin, children_[index]->get_size()},
+            terminalpp::rectangle{{}, bounds_.size});
+
+        if (!visible_region)
+        {
+            return;
+        }
+
+        auto clipped_end = regions.begin();
+
+        for (auto rect : regions)
+        {
+            rect.origin.x += origin.x;
+            rect.origin.y += origin.y;
+
+            auto const clipped_rect = 
+                detail::intersection(rect, *visible_region);
+
+            if (clipped_rect)
+            {
+                *clipped_end++ = *clipped_rect;
+            }
+        }
+
+        regions.erase(clipped_end, regions.end());
+
+        if (!regions.empty())
+        {
+            on_redraw(regions);
+        }
+    }
+
+    // ======================================================================
+    // SUBCOMPONENT_SCROLL_HANDLER
+    // ======================================================================
+    bool subcomponent_scroll_handler(
+        std::size_t                 index, 
+        terminalpp::rectangle       region,
+        terminalpp::coordinate_type rows)
+    {
+        if (in_layout_)
+        {
+            return true;
+        }
+
+        auto const &comp = *children_[index];
+        region.origin.x += comp.get_position().x;
+        region.origin.y += comp.get_position().y;
+
+        // As with container, what was drawn may only be moved if the whole
+        // region is visible and belongs to the subcomponent alone.
+        auto const region_is_within = 
+            [&region](terminalpp::rectangle const &bounds)
+            {
+                auto const overlap = detail::intersection(region, bounds);
+                return overlap && *overlap == region;
+            };
+
+        if (!region_is_within({{}, bounds_.size})
+         || !region_is_within({comp.get_position(), comp.get_size()}))
+        {
+            return false;
+        }
+
+        for (auto const *sibling : children_)
+        {
+            if (sibling != &comp
+             && detail::intersection(
+                    region, {sibling->get_position(), sibling->get_size()}))
+            {
+                return false;
+            }
+        }
+
+        return on_scroll(region, rows).get_value_or(false);
+    }
+
+    // ======================================================================
+    // SUBCOMPONENT_FOCUS_SET_HANDLER
+    // ======================================================================
+    void subcomponent_focus_set_handler(std::size_t index)
+    {
+        if (in_focus_operation_)
+        {
+            return;
+        }
+
+        auto const previous_index = 
+            std::exchange(focussed_index_, boost::make_optional(index));
+
+        if (previous_index && *previous_index != index)
+        {
+            in_focus_operation_ = true;
+
+            BOOST_SCOPE_EXIT_ALL(this)
+            {
+                in_focus_operation_ = false;
+            };
+
+            children_[*previous_index]->lose_focus();
+        }
+        else if (!std::exchange(has_focus_, true))
+        {
+            on_focus_set();
+        }
+
+        on_cursor_position_changed();
+        on_cursor_state_changed();
+    }
+
+    // ======================================================================
+    // SUBCOMPONENT_FOCUS_LOST_HANDLER
+    // ======================================================================
+    void subcomponent_focus_lost_handler(std::size_t index)
+    {
+        if (!in_focus_operation_ && focussed_index_ == index)
+        {
+            focussed_index_ = boost::none;
+            has_focus_ = false;
+            on_focus_lost();
+        }
+    }
+
+    // ======================================================================
+    // FOCUS_INCREMENTAL
+    // ======================================================================
+    template <class Order, class Op>
+    void focus_incremental(Order &&order, Op &&increment_op)
+    {
+        in_focus_operation_ = true;
+
+        BOOST_SCOPE_EXIT_ALL(this)
+        {
+            in_focus_operation_ = false;
+        };
+
+        bool const had_focus = has_focus_;
+        auto const previous_index = focussed_index_;
+
+        // Focus moves on from the focussed subcomponent, or from the first
+        // subcomponent in the order of movement if none has focus.
+        auto step = std::size_t{0};
+
+        if (previous_index)
+        {
+            while (order(step) != *previous_index)
+            {
+                ++step;
+            }
+        }
+
+        focussed_index_ = boost::none;
+
+        for (; step < count; ++step)
+        {
+            auto &comp = *children_[order(step)];
+            increment_op(comp);
+
+            if (comp.has_focus())
+            {
+                focussed_index_ = order(step);
+                break;
+            }
+        }
+
+        has_focus_ = focussed_index_.is_initialized();
+
+        if (had_focus != has_focus_)
+        {
+            if (has_focus_)
+            {
+                on_focus_set();
+            }
+            else
+            {
+                on_focus_lost();
+            }
+
+            on_cursor_position_changed();
+            on_cursor_state_changed();
+        }
+        else if (has_focus_ && previous_index != focussed_index_)
+        {
+            on_cursor_position_changed();
+            on_cursor_state_changed();
+        }
+    }
+
+    Layout                              layout_;
+
+    // Layout is performed lazily from const functions, and moves and 
+    // resizes the subcomponents, so they and the layout state are mutable.
+    mutable std::tuple<Components...>   components_;
+    std::array<component *, count>      children_;
+    terminalpp::rectangle               bounds_;
+    bool                                has_focus_ = false;
+    bool                                in_focus_operation_ = false;
+    mutable bool                        layout_dirty_ = false;
+    mutable bool                        layout_redraw_announced_ = false;
+    mutable bool                        in_layout_ = false;
+    boost::optional<std::size_t>        focussed_index_;
+};
+
+template <class Layout, class... Components>
+constexpr std::size_t static_container<Layout, Components...>::count;
+
+}
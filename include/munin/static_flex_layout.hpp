@@ -0,0 +1,154 @@
+#pragma once
+
+#include "munin/detail/algorithm.hpp"
+#include "munin/detail/flex_solver.hpp"
+#include "munin/flex_track.hpp"
+#include <terminalpp/extent.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <tuple>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief A layout policy for a static_container that places a fixed
+/// number of components in a single row or column of tracks, exactly as a
+/// flex_layout does.  The direction and the number of tracks are known at
+/// compile time, so the layout is solved without any allocation or virtual
+/// dispatch into the layout itself.
+//* =========================================================================
+template <flex_direction Direction, std::size_t Count>
+class static_flex_layout
+{
+public :
+    //* =====================================================================
+    /// \brief Constructor
+    //* =====================================================================
+    constexpr explicit static_flex_layout(
+        std::array<flex_track, Count> const &tracks)
+      : tracks_(tracks)
+    {
+    }
+
+    //* =====================================================================
+    /// \brief Returns the preferred size of the given components when laid
+    /// out by this policy.
+    //* =====================================================================
+    template <class... Components>
+    terminalpp::extent get_preferred_size(
+        std::tuple<Components...> const &components) const
+    {
+        static_assert(
+            sizeof...(Components) == Count,
+            "a static_flex_layout needs exactly one track per component");
+
+        auto main  = terminalpp::coordinate_type{0};
+        auto cross = terminalpp::coordinate_type{0};
+
+        detail::for_each_in_tuple(
+            components,
+            [this, &main, &cross](auto const &comp, std::size_t index)
+            {
+                auto const preferred_size = comp.get_preferred_size();
+
+                main += detail::preferred_track_size(
+                    tracks_[index], 
+                    detail::main_axis(preferred_size, Direction));
+
+                cross = (std::max)(
+                    cross, detail::cross_axis(preferred_size, Direction));
+            });
+
+        return detail::make_flex_extent(main, cross, Direction);
+    }
+
+    //* =====================================================================
+    /// \brief Lays the given components out within the given size.
+    //* =====================================================================
+    template <class... Components>
+    void operator()(
+        std::tuple<Components...> &components, 
+        terminalpp::extent         size) const
+    {
+        static_assert(
+            sizeof...(Components) == Count,
+            "a static_flex_layout needs exactly one track per component");
+
+        // The preferred sizes are gathered in one pass over the tuple, and
+        // the geometry of the tracks is then solved in the usual way.
+        std::array<terminalpp::coordinate_type, Count> preferred_sizes;
+        std::array<terminalpp::coordinate_type, Count> positions;
+        std::array<terminalpp::coordinate_type, Count> sizes;
+
+        detail::for_each_in_tuple(
+            components,
+            [&preferred_sizes](auto const &comp, std::size_t index)
+            {
+                preferred_sizes[index] = detail::main_axis(
+                    comp.get_preferred_size(), Direction);
+            });
+
+        detail::solve_flex_tracks(
+            Count,
+            detail::main_axis(size, Direction),
+            [this](std::size_t index) -> flex_track const &
+            {
+                return tracks_[index];
+            },
+            [&preferred_sizes](std::size_t index)
+            {
+                return preferred_sizes[index];
+            },
+            [&positions, &sizes](
+                std::size_t                 index, 
+                terminalpp::coordinate_type position, 
+                terminalpp::coordinate_type track_size)
+            {
+                positions[index] = position;
+                sizes[index]     = track_size;
+            });
+
+        auto const cross_size = detail::cross_axis(size, Direction);
+
+        detail::for_each_in_tuple(
+            components,
+            [&positions, &sizes, cross_size](auto &comp, std::size_t index)
+            {
+                comp.set_position(
+                    detail::make_flex_point(positions[index], 0, Direction));
+                comp.set_size(
+                    detail::make_flex_extent(
+                        sizes[index], cross_size, Direction));
+            });
+    }
+
+    //* =====================================================================
+    /// \brief Returns details about the layout in JSON format.
+    //* =====================================================================
+    nlohmann::json to_json() const
+    {
+        return {
+            { "type",      "static_flex_layout" },
+            { "direction", Direction == flex_direction::row ? "row" : "column" }
+        };
+    }
+
+private :
+    std::array<flex_track, Count> tracks_;
+};
+
+//* =========================================================================
+/// \brief Returns a static flex layout with one track for each of the
+/// given tracks, in order.
+//* =========================================================================
+template <flex_direction Direction, class... Tracks>
+constexpr static_flex_layout<Direction, sizeof...(Tracks)> 
+make_static_flex_layout(Tracks const &...tracks)
+{
+    return static_flex_layout<Direction, sizeof...(Tracks)>{
+        std::array<flex_track, sizeof...(Tracks)>{{ tracks... }}};
+}
+
+}
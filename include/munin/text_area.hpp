@@ -63,6 +63,20 @@ public:
     > on_caret_position_changed;
 
 protected:
+    //* =====================================================================
+    /// \brief Returns the extent of the text as it is laid out at the 
+    /// current width of the text area.  This is known without examining
+    /// the text.
+    //* =====================================================================
+    terminalpp::extent get_laid_out_extent() const;
+
+    //* =====================================================================
+    /// \brief Called by set_size().  Derived classes must override this
+    /// function in order to set the size of the component in a custom
+    /// manner.
+    //* =====================================================================
+    void do_set_size(terminalpp::extent const &size) override;
+
     //* =====================================================================
     /// \brief Called by get_preferred_size().  Derived classes must override
     /// this function in order to get the size of the component in a custom
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "munin/export.hpp"
+
+namespace munin {
+
+//* =========================================================================
+/// \brief An object that, for its lifetime, defers the notifications that
+/// are passed up through the component hierarchy.
+/// \par
+/// While a transaction is in progress, containers and viewports accumulate
+/// the redraw, cursor and preferred size notifications they receive from 
+/// their subcomponents rather than passing each one on immediately.  When
+/// the outermost transaction on the current thread ends, the accumulated
+/// notifications are announced once each.  For example, feeding each 
+/// character of a pasted line to an edit within a transaction results in 
+/// a single redraw notification reaching the window, rather than one per 
+/// character.
+/// \par
+/// Transactions may be nested, in which case only the end of the
+/// outermost transaction causes notifications to be announced.
+//* =========================================================================
+class MUNIN_EXPORT update_transaction
+{
+public :
+    //* =====================================================================
+    /// \brief Constructor.  Begins the transaction.
+    //* =====================================================================
+    update_transaction();
+
+    //* =====================================================================
+    /// \brief Destructor.  Ends the transaction.
+    //* =====================================================================
+    ~update_transaction();
+
+    update_transaction(update_transaction const &) = delete;
+    update_transaction &operator=(update_transaction const &) = delete;
+};
+
+}
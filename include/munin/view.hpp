@@ -2,25 +2,34 @@
 
 #include <munin/container.hpp>
 #include <munin/layout.hpp>
-#include <boost/any.hpp>
+#include <munin/layout_hint.hpp>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace munin { namespace detail {
 
+// The components and hints collected from the arguments to view(), which
+// are then added to the container in one go.
+struct view_content
+{
+    std::vector<std::shared_ptr<component>> components;
+    std::vector<layout_hint>                hints;
+};
+
 // Overload where the next argument is convertible to a component.    
 template <class... Args>
 void view_helper(
-    std::shared_ptr<container> const &content,
+    view_content                     &content,
     std::shared_ptr<component> const &prev,
     std::shared_ptr<component> const &comp, 
     Args&&... args);
 
 // Overload where the next argument is not convertible to a component.
-// In this case, the argument is automatically wrapped in a Boost.Any
-// object and passed as the layout hint.
+// In this case, the argument is automatically wrapped in a layout_hint
+// and passed as such.
 template <
     class Hint, 
     class = typename std::enable_if<
@@ -29,19 +38,20 @@ template <
     class... Args
 >
 void view_helper(
-    std::shared_ptr<container> const &content,
+    view_content                     &content,
     std::shared_ptr<component> const &prev,
     Hint&& hint, 
     Args&&... args);
 
 // Overload where there is no next argument.  This is the terminal case.
 inline void view_helper(
-    std::shared_ptr<container> const &content,
+    view_content                     &content,
     std::shared_ptr<component> const &prev)
 {
     if (prev)
     {
-        content->add_component(prev);
+        content.components.push_back(prev);
+        content.hints.emplace_back();
     }
 }
     
@@ -76,10 +86,18 @@ std::shared_ptr<container> view(
     std::unique_ptr<layout> lyt,
     Args&&... args)
 {
+    detail::view_content content;
+    content.components.reserve(sizeof...(Args));
+    content.hints.reserve(sizeof...(Args));
+
+    detail::view_helper(
+        content, std::shared_ptr<component>{}, std::forward<Args>(args)...);
+
+    // The layout is set before the components are added so that the
+    // container is laid out only once, after all of them are present.
     auto comp = munin::make_container();
     comp->set_layout(std::move(lyt));
-    detail::view_helper(
-        comp, std::shared_ptr<component>{}, std::forward<Args>(args)...);
+    comp->add_components(content.components, content.hints);
     
     return comp;
 }
@@ -88,14 +106,15 @@ namespace detail {
     
 template <class... Args>
 void view_helper(
-    std::shared_ptr<container> const &content, 
+    view_content                     &content, 
     std::shared_ptr<component> const &prev,
     std::shared_ptr<component> const &comp, 
     Args&&... args)
 {
     if (prev)
     {
-        content->add_component(prev);
+        content.components.push_back(prev);
+        content.hints.emplace_back();
     }
     
     view_helper(content, comp, std::forward<Args>(args)...);
@@ -107,14 +126,15 @@ template <
     class... Args
 >
 void view_helper(
-    std::shared_ptr<container> const &content,
+    view_content                     &content,
     std::shared_ptr<component> const &prev,
     Hint&& hint, 
     Args&&... args)
 {
     if (prev)
     {
-        content->add_component(prev, boost::any(std::forward<Hint>(hint)));
+        content.components.push_back(prev);
+        content.hints.emplace_back(std::forward<Hint>(hint));
     }
     
     view_helper(content, {}, std::forward<Args>(args)...);
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "munin/export.hpp"
+#include <terminalpp/extent.hpp>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief An interface for components whose content may be far larger than
+/// any area in which it is shown, such as a long scrollback.
+/// \par
+/// A viewport that tracks a component with virtual content does not size
+/// the component to fit all of its content, nor ask for its preferred 
+/// size.  Instead, it asks for the extent of the content, which must be 
+/// cheap to compute, and gives the component only the size of the 
+/// viewport.  The component is then asked to draw regions in content 
+/// co-ordinates, which may lie anywhere within the content extent, and 
+/// must do so at a cost proportional to the size of the region.  Its 
+/// cursor position and any redraw regions that it announces are also in 
+/// content co-ordinates.
+/// \par
+/// A change in the extent of the content is announced with the 
+/// component's on_preferred_size_changed signal.
+//* =========================================================================
+class MUNIN_EXPORT virtual_content
+{
+public :
+    //* =====================================================================
+    /// \brief Destructor
+    //* =====================================================================
+    virtual ~virtual_content() = default;
+
+    //* =====================================================================
+    /// \brief Returns the extent of the content.
+    //* =====================================================================
+    terminalpp::extent get_content_extent() const;
+
+protected :
+    //* =====================================================================
+    /// \brief Called by get_content_extent().  Derived classes must 
+    /// override this function in order to return the extent of their 
+    /// content.
+    //* =====================================================================
+    virtual terminalpp::extent do_get_content_extent() const = 0;
+};
+
+}
@@ -1,18 +1,58 @@
 #pragma once
 
 #include "munin/export.hpp"
+#include "munin/update_transaction.hpp"
 #include <terminalpp/canvas.hpp>
 #include <terminalpp/extent.hpp>
 #include <terminalpp/terminal.hpp>
 #include <nlohmann/json.hpp>
 #include <boost/any.hpp>
 #include <boost/signals2/signal.hpp>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace munin {
 
 class component;
 
+//* =========================================================================
+/// \brief Counters that describe the cumulative cost of repainting a 
+/// window.
+//* =========================================================================
+struct window_statistics
+{
+    /// The number of redraw notifications received from the content.
+    std::uint64_t repaint_requests = 0;
+    
+    /// The number of times the window has been repainted.
+    std::uint64_t repaints = 0;
+    
+    /// The number of regions drawn, after overlapping and adjacent
+    /// requests have been merged.
+    std::uint64_t merged_regions = 0;
+    
+    /// The number of cells that the content was asked to draw.
+    std::uint64_t cells_drawn = 0;
+    
+    /// The number of bytes of paint data produced.
+    std::uint64_t bytes_emitted = 0;
+
+    /// The number of times that content was moved by scrolling the 
+    /// terminal rather than by painting it again.
+    std::uint64_t scrolls = 0;
+
+    /// The time spent drawing the content onto the canvas.
+    std::chrono::nanoseconds draw_time{0};
+
+    /// The time spent comparing the canvas against the previous frame and
+    /// producing the paint data.
+    std::chrono::nanoseconds diff_time{0};
+
+    /// The size of the largest single region drawn.
+    terminalpp::extent largest_region;
+};
+
 //* =========================================================================
 /// \brief An object that represents a top-level window.
 //* =========================================================================
@@ -37,6 +77,22 @@ public :
     //* =====================================================================
     void event(boost::any const &ev);
 
+    //* =====================================================================
+    /// \brief Send a sequence of events to the window.  Notifications
+    /// caused by the events are deferred until all of the events have been
+    /// processed.  See update_transaction.
+    //* =====================================================================
+    template <class EventRange>
+    void events(EventRange const &evs)
+    {
+        update_transaction const transaction;
+
+        for (auto const &ev : evs)
+        {
+            event(ev);
+        }
+    }
+
     //* =====================================================================
     /// \brief Returns a string that represents the change in state of the
     /// window since the last repaint.
@@ -44,6 +100,33 @@ public :
     std::string repaint(
         terminalpp::canvas &cvs, terminalpp::terminal &term);
 
+    //* =====================================================================
+    /// \brief Appends a string that represents the change in state of the
+    /// window since the last repaint to the given buffer.
+    /// \par
+    /// The buffer is not cleared beforehand, so a buffer that is reused
+    /// between repaints will not need to be reallocated once it has grown
+    /// to a sufficient capacity.
+    //* =====================================================================
+    void repaint(
+        terminalpp::canvas &cvs, 
+        terminalpp::terminal &term, 
+        std::string &paint_data);
+
+    //* =====================================================================
+    /// \brief Returns counters that describe the cost of repainting this
+    /// window since it was created.
+    //* =====================================================================
+    window_statistics const &get_statistics() const;
+
+    //* =====================================================================
+    /// \brief Returns whether the window has requested a repaint that has
+    /// not yet been performed.  on_repaint_request is only signalled for
+    /// the first request after each repaint, so this allows an observer
+    /// that connects late to learn of a request that it missed.
+    //* =====================================================================
+    bool repaint_requested() const;
+
     //* =====================================================================
     /// \brief Returns a JSON representation of the current state of the
     /// window and its content.
@@ -134,10 +134,10 @@ terminalpp::point calculate_component_position(
 // ==========================================================================
 // CALCULATE_ALIGNMENT
 // ==========================================================================
-alignment calculate_alignment(boost::any const &hint)
+alignment calculate_alignment(layout_hint const &hint)
 {
     auto const *alignment_hint =
-        boost::any_cast<alignment>(&hint);
+        boost::get<alignment>(&hint);
 
     // By default, components are centre-aligned.
     return alignment_hint != nullptr
@@ -155,7 +155,7 @@ alignment calculate_alignment(boost::any const &hint)
 // ==========================================================================
 terminalpp::extent aligned_layout::do_get_preferred_size(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints) const
+    std::vector<layout_hint>                const &hints) const
 {
     // The preferred size of this component is the largest preferred
     // extents of all components.
@@ -178,7 +178,7 @@ terminalpp::extent aligned_layout::do_get_preferred_size(
 // ==========================================================================
 void aligned_layout::do_layout(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints,
+    std::vector<layout_hint>                const &hints,
     terminalpp::extent                             size) const
 {
     for (uint32_t index = 0; index < components.size(); ++index)
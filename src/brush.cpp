@@ -1,8 +1,8 @@
 #include "munin/brush.hpp"
 #include "munin/render_surface.hpp"
-#include <terminalpp/algorithm/for_each_in_region.hpp>
 #include <boost/range/algorithm/max_element.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <algorithm>
 #include <utility>
 
 using namespace terminalpp::literals;
@@ -89,18 +89,33 @@ terminalpp::extent brush::do_get_preferred_size() const
 void brush::do_draw(
     render_surface &surface, terminalpp::rectangle const &region) const
 {
-    terminalpp::for_each_in_region(
-        surface,
-        region,
-        [this](terminalpp::element &elem, 
-               terminalpp::coordinate_type column, 
-               terminalpp::coordinate_type row)
+    auto const region_end = region.origin.x + region.size.width;
+
+    for (auto row = region.origin.y;
+         row < region.origin.y + region.size.height;
+         ++row)
+    {
+        auto const &pattern_row = pattern_[row % pattern_.size()];
+        auto const pattern_width = 
+            terminalpp::coordinate_type(pattern_row.size());
+
+        // Write the row as a series of runs, each of which is the part of 
+        // the pattern that lies between the current column and either the
+        // end of the pattern or the end of the region.
+        for (auto column = region.origin.x; column < region_end;)
         {
-            auto const fill_row = row % pattern_.size();
-            auto const fill_column = column % pattern_[fill_row].size();
+            auto const pattern_column = column % pattern_width;
+            auto const run_width = (std::min)(
+                pattern_width - pattern_column, region_end - column);
 
-            elem = pattern_[fill_row][fill_column];
-        });
+            surface.write_row(
+                { column, row },
+                pattern_row.begin() + pattern_column,
+                pattern_row.begin() + pattern_column + run_width);
+
+            column += run_width;
+        }
+    }
 }
 
 // ==========================================================================
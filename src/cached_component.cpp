@@ -0,0 +1,370 @@
+#include "munin/cached_component.hpp"
+#include "munin/render_surface.hpp"
+#include "munin/detail/algorithm.hpp"
+#include "munin/detail/region.hpp"
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/make_unique.hpp>
+#include <boost/optional.hpp>
+#include <utility>
+
+namespace munin {
+
+namespace {
+
+// ==========================================================================
+// CACHE_CAPABILITIES
+// ==========================================================================
+// The cache is drawn with the same capabilities as the surface it is 
+// eventually copied to.
+class cache_capabilities : public render_surface_capabilities
+{
+public :
+    // ======================================================================
+    // CONSTRUCTOR
+    // ======================================================================
+    explicit cache_capabilities(bool supports_unicode)
+      : supports_unicode_(supports_unicode)
+    {
+    }
+
+    // ======================================================================
+    // SUPPORTS_UNICODE
+    // ======================================================================
+    bool supports_unicode() const override
+    {
+        return supports_unicode_;
+    }
+
+private :
+    bool supports_unicode_;
+};
+
+}
+
+// ==========================================================================
+// CACHED_COMPONENT::IMPLEMENTATION STRUCTURE
+// ==========================================================================
+struct cached_component::impl
+{
+    // ======================================================================
+    // CONSTRUCTOR
+    // ======================================================================
+    impl(cached_component &self, std::shared_ptr<component> cached)
+      : self_(self),
+        cached_(std::move(cached))
+    {
+        cached_->on_preferred_size_changed.connect(
+            self_.on_preferred_size_changed);
+        cached_->on_cursor_state_changed.connect(
+            self_.on_cursor_state_changed);
+        cached_->on_cursor_position_changed.connect(
+            self_.on_cursor_position_changed);
+        cached_->on_focus_set.connect(self_.on_focus_set);
+        cached_->on_focus_lost.connect(self_.on_focus_lost);
+        cached_->on_redraw.connect(
+            [this](auto const &regions)
+            {
+                this->on_cached_component_redraw(regions);
+            });
+        cached_->on_scroll.connect(
+            [this](auto const &region, auto rows)
+            {
+                return this->on_cached_component_scroll(region, rows);
+            });
+    }
+
+    // ======================================================================
+    // SET_SIZE
+    // ======================================================================
+    void set_size(terminalpp::extent const &size)
+    {
+        cached_->set_size(size);
+        
+        // The entire cache is now stale.
+        cache_ = boost::none;
+        invalid_region_.clear();
+    }
+
+    // ======================================================================
+    // DRAW
+    // ======================================================================
+    void draw(render_surface &surface, terminalpp::rectangle const &region)
+    {
+        auto const size = self_.get_size();
+        auto const supports_unicode = surface.supports_unicode();
+
+        if (!cache_ || supports_unicode != cache_supports_unicode_)
+        {
+            cache_.emplace(size);
+            cache_supports_unicode_ = supports_unicode;
+            invalid_region_.clear();
+            invalid_region_.add({{}, size});
+        }
+
+        refresh_cache();
+
+        auto const draw_region = 
+            detail::intersection(region, terminalpp::rectangle{{}, size});
+
+        if (!draw_region)
+        {
+            return;
+        }
+
+        auto const &cache = *cache_;
+
+        for (auto row = draw_region->origin.y;
+             row < draw_region->origin.y + draw_region->size.height;
+             ++row)
+        {
+            auto const cache_element = 
+                [&cache, row](terminalpp::coordinate_type column)
+                {
+                    return cache[column][row];
+                };
+
+            auto const first_column = boost::make_counting_iterator(
+                draw_region->origin.x);
+            auto const last_column = boost::make_counting_iterator(
+                draw_region->origin.x + draw_region->size.width);
+
+            surface.write_row(
+                { draw_region->origin.x, row },
+                boost::make_transform_iterator(first_column, cache_element),
+                boost::make_transform_iterator(last_column, cache_element));
+        }
+    }
+
+    cached_component &self_;
+    std::shared_ptr<component> cached_;
+
+private :
+    // ======================================================================
+    // REFRESH_CACHE
+    // ======================================================================
+    void refresh_cache()
+    {
+        if (invalid_region_.empty())
+        {
+            return;
+        }
+
+        cache_capabilities const capabilities{cache_supports_unicode_};
+        render_surface cache_surface{*cache_, capabilities};
+
+        for (auto const &rect : invalid_region_.rectangles())
+        {
+            cached_->draw(cache_surface, rect);
+        }
+
+        invalid_region_.clear();
+    }
+
+    // ======================================================================
+    // ON_CACHED_COMPONENT_REDRAW
+    // ======================================================================
+    void on_cached_component_redraw(
+        rectangle_list const &regions)
+    {
+        if (cache_)
+        {
+            auto const bounds = terminalpp::rectangle{{}, cache_->size()};
+
+            for (auto const &region : regions)
+            {
+                auto const stale_region = 
+                    detail::intersection(region, bounds);
+
+                if (stale_region)
+                {
+                    invalid_region_.add(*stale_region);
+                }
+            }
+        }
+
+        self_.on_redraw(regions);
+    }
+
+    // ======================================================================
+    // ON_CACHED_COMPONENT_SCROLL
+    // ======================================================================
+    bool on_cached_component_scroll(
+        terminalpp::rectangle const &region, 
+        terminalpp::coordinate_type  rows)
+    {
+        // The cache is moved along with the content, so that only the rows
+        // that are exposed need to be drawn into it again.  Those will be 
+        // announced as redraws, and so invalidated, in due course.
+        if (cache_)
+        {
+            auto const bounds = terminalpp::rectangle{{}, cache_->size()};
+            auto const cached_region = detail::intersection(region, bounds);
+
+            if (cached_region && *cached_region == region)
+            {
+                detail::scroll_canvas(*cache_, region, rows);
+                invalid_region_.scroll(region, rows);
+            }
+            else if (cached_region)
+            {
+                invalid_region_.add(*cached_region);
+            }
+        }
+
+        return self_.on_scroll(region, rows).get_value_or(false);
+    }
+
+    boost::optional<terminalpp::canvas> cache_;
+    bool cache_supports_unicode_ = true;
+    detail::region invalid_region_;
+};
+
+// ==========================================================================
+// CONSTRUCTOR
+// ==========================================================================
+cached_component::cached_component(std::shared_ptr<component> cached)
+  : pimpl_(boost::make_unique<impl>(*this, std::move(cached)))
+{
+}
+
+// ==========================================================================
+// DESTRUCTOR
+// ==========================================================================
+cached_component::~cached_component() = default;
+
+// ==========================================================================
+// DO_SET_SIZE
+// ==========================================================================
+void cached_component::do_set_size(terminalpp::extent const &size)
+{
+    // An unchanged size leaves the cache valid.
+    if (size == get_size())
+    {
+        return;
+    }
+
+    basic_component::do_set_size(size);
+    pimpl_->set_size(size);
+}
+
+// ==========================================================================
+// DO_GET_PREFERRED_SIZE
+// ==========================================================================
+terminalpp::extent cached_component::do_get_preferred_size() const
+{
+    return pimpl_->cached_->get_preferred_size();
+}
+
+// ==========================================================================
+// DO_HAS_FOCUS
+// ==========================================================================
+bool cached_component::do_has_focus() const
+{
+    return pimpl_->cached_->has_focus();
+}
+
+// ==========================================================================
+// DO_SET_FOCUS
+// ==========================================================================
+void cached_component::do_set_focus()
+{
+    pimpl_->cached_->set_focus();
+}
+
+// ==========================================================================
+// DO_LOSE_FOCUS
+// ==========================================================================
+void cached_component::do_lose_focus()
+{
+    pimpl_->cached_->lose_focus();
+}
+
+// ==========================================================================
+// DO_FOCUS_NEXT
+// ==========================================================================
+void cached_component::do_focus_next()
+{
+    pimpl_->cached_->focus_next();
+}
+
+// ==========================================================================
+// DO_FOCUS_PREVIOUS
+// ==========================================================================
+void cached_component::do_focus_previous()
+{
+    pimpl_->cached_->focus_previous();
+}
+
+// ==========================================================================
+// DO_GET_CURSOR_STATE
+// ==========================================================================
+bool cached_component::do_get_cursor_state() const
+{
+    return pimpl_->cached_->get_cursor_state();
+}
+
+// ==========================================================================
+// DO_GET_CURSOR_POSITION
+// ==========================================================================
+terminalpp::point cached_component::do_get_cursor_position() const
+{
+    return pimpl_->cached_->get_cursor_position();
+}
+
+// ==========================================================================
+// DO_SET_CURSOR_POSITION
+// ==========================================================================
+void cached_component::do_set_cursor_position(
+    terminalpp::point const &position)
+{
+    pimpl_->cached_->set_cursor_position(position);
+}
+
+// ==========================================================================
+// DO_DRAW
+// ==========================================================================
+void cached_component::do_draw(
+    render_surface &surface,
+    terminalpp::rectangle const &region) const
+{
+    pimpl_->draw(surface, region);
+}
+
+// ==========================================================================
+// DO_IS_OPAQUE
+// ==========================================================================
+bool cached_component::do_is_opaque() const
+{
+    return pimpl_->cached_->is_opaque();
+}
+
+// ==========================================================================
+// DO_EVENT
+// ==========================================================================
+void cached_component::do_event(boost::any const &event)
+{
+    pimpl_->cached_->event(event);
+}
+
+// ==========================================================================
+// DO_TO_JSON
+// ==========================================================================
+nlohmann::json cached_component::do_to_json() const
+{
+    auto json = basic_component::do_to_json();
+    json["type"] = "cached_component";
+    json["content"] = pimpl_->cached_->to_json();
+    return json;
+}
+
+// ==========================================================================
+// MAKE_CACHED_COMPONENT
+// ==========================================================================
+std::shared_ptr<cached_component> make_cached_component(
+    std::shared_ptr<component> cached)
+{
+    return std::make_shared<cached_component>(std::move(cached));
+}
+
+}
@@ -129,7 +129,7 @@ static void layout_east_component(
 // ==========================================================================
 terminalpp::extent compass_layout::do_get_preferred_size(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints) const
+    std::vector<layout_hint>                const &hints) const
 {
     // Keeps track of the "unused" area that a centre component would fit 
     // into. For example, with a north component of (3,1) and an east 
@@ -149,8 +149,8 @@ terminalpp::extent compass_layout::do_get_preferred_size(
     for (auto index = 0u; index < components.size(); ++index)
     {
         auto &comp            = *components[index];
-        auto const *hint_any  = boost::any_cast<heading>(&hints[index]);
-        auto const hint       = hint_any ? *hint_any : heading::centre;
+        auto const *hint_ptr  = boost::get<heading>(&hints[index]);
+        auto const hint       = hint_ptr ? *hint_ptr : heading::centre;
         auto const &comp_preferred_size = comp.get_preferred_size();
 
         switch (hint)
@@ -216,7 +216,7 @@ terminalpp::extent compass_layout::do_get_preferred_size(
 // ==========================================================================
 void compass_layout::do_layout(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints,
+    std::vector<layout_hint>                const &hints,
     terminalpp::extent                             size) const
 {
     std::vector<component*> centre_components;
@@ -225,8 +225,8 @@ void compass_layout::do_layout(
     for (auto index = 0u; index < components.size(); ++index)
     {
         auto &comp           = *components[index];
-        auto const *hint_any = boost::any_cast<heading>(&hints[index]);
-        auto const hint      = hint_any ? *hint_any : heading::centre;
+        auto const *hint_ptr = boost::get<heading>(&hints[index]);
+        auto const hint      = hint_ptr ? *hint_ptr : heading::centre;
 
         switch (hint)
         {
@@ -3,6 +3,21 @@
 
 namespace munin {
 
+// ==========================================================================
+// CONSTRUCTOR
+// ==========================================================================
+component::component()
+{
+    // This is connected at the front so that any other observer of the
+    // signal that queries the preferred size receives the new one.
+    on_preferred_size_changed.connect(
+        [this]
+        {
+            preferred_size_ = boost::none;
+        },
+        boost::signals2::at_front);
+}
+
 // ==========================================================================
 // SET_POSITION
 // ==========================================================================
@@ -16,6 +31,7 @@ void component::set_position(terminalpp::point const &position)
 // ==========================================================================
 terminalpp::point component::get_position() const
 {
+    flush_owner_layout();
     return do_get_position();
 }
 
@@ -34,6 +50,7 @@ void component::set_size(terminalpp::extent const &size)
 // ==========================================================================
 terminalpp::extent component::get_size() const
 {
+    flush_owner_layout();
     return do_get_size();
 }
 
@@ -42,7 +59,12 @@ terminalpp::extent component::get_size() const
 // ==========================================================================
 terminalpp::extent component::get_preferred_size() const
 {
-    return do_get_preferred_size();
+    if (!preferred_size_)
+    {
+        preferred_size_ = do_get_preferred_size();
+    }
+
+    return *preferred_size_;
 }
 
 // ==========================================================================
@@ -118,6 +140,14 @@ void component::draw(
     do_draw(surface, region);
 }
 
+// ==========================================================================
+// IS_OPAQUE
+// ==========================================================================
+bool component::is_opaque() const
+{
+    return do_is_opaque();
+}
+
 // ==========================================================================
 // EVENT
 // ==========================================================================
@@ -134,4 +164,52 @@ nlohmann::json component::to_json() const
     return do_to_json();
 }
 
+// ==========================================================================
+// DO_IS_OPAQUE
+// ==========================================================================
+bool component::do_is_opaque() const
+{
+    return false;
+}
+
+// ==========================================================================
+// DO_FLUSH_LAYOUT
+// ==========================================================================
+void component::do_flush_layout() const
+{
+}
+
+// ==========================================================================
+// SET_LAYOUT_OWNER
+// ==========================================================================
+void component::set_layout_owner(
+    component &subcomponent, component const &owner)
+{
+    subcomponent.layout_owner_ = &owner;
+}
+
+// ==========================================================================
+// RELEASE_LAYOUT_OWNER
+// ==========================================================================
+void component::release_layout_owner(
+    component &subcomponent, component const &owner)
+{
+    if (subcomponent.layout_owner_ == &owner)
+    {
+        subcomponent.layout_owner_ = nullptr;
+    }
+}
+
+// ==========================================================================
+// FLUSH_OWNER_LAYOUT
+// ==========================================================================
+void component::flush_owner_layout() const
+{
+    if (layout_owner_ != nullptr)
+    {
+        layout_owner_->flush_owner_layout();
+        layout_owner_->do_flush_layout();
+    }
+}
+
 }
@@ -8,7 +8,17 @@ namespace munin {
 // ==========================================================================
 composite_component::composite_component()
 {
+    // The content is positioned and sized along with this component, so
+    // any layout pending above this component must be performed before
+    // the content's geometry is read.
+    set_layout_owner(content_, *this);
+
     content_.on_redraw.connect(on_redraw);
+    content_.on_scroll.connect(
+        [this](auto const &region, auto rows)
+        {
+            return on_scroll(region, rows).get_value_or(false);
+        });
     content_.on_preferred_size_changed.connect(on_preferred_size_changed);
     content_.on_focus_set.connect(on_focus_set);
     content_.on_focus_lost.connect(on_focus_lost);
@@ -16,6 +26,14 @@ composite_component::composite_component()
     content_.on_cursor_position_changed.connect(on_cursor_position_changed);
 }
 
+// ==========================================================================
+// FLUSH_LAYOUT
+// ==========================================================================
+void composite_component::flush_layout()
+{
+    content_.flush_layout();
+}
+
 // ==========================================================================
 // SET_LAYOUT
 // ==========================================================================
@@ -29,7 +47,7 @@ void composite_component::set_layout(std::unique_ptr<layout> lyt)
 // ==========================================================================
 void composite_component::add_component(
     std::shared_ptr<component> const &comp,
-    boost::any const &hint)
+    layout_hint const &hint)
 {
     content_.add_component(comp, hint);
 }
@@ -3,15 +3,24 @@
 #include "munin/null_layout.hpp"
 #include "munin/render_surface.hpp"
 #include "munin/detail/algorithm.hpp"
+#include "munin/detail/deferred_notifications.hpp"
 #include "munin/detail/json_adaptors.hpp"
+#include "munin/detail/region.hpp"
 #include <terminalpp/ansi/mouse.hpp>
 #include <terminalpp/rectangle.hpp>
 #include <boost/make_unique.hpp>
+#include <boost/algorithm/cxx11/any_of.hpp>
+#include <boost/algorithm/cxx11/none_of.hpp>
 #include <boost/optional.hpp>
+#include <boost/range/algorithm/find.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <boost/range/adaptor/transformed.hpp>
+#include <boost/range/irange.hpp>
 #include <boost/scope_exit.hpp>
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace munin {
@@ -21,6 +30,26 @@ namespace {
 using component_connections =
     std::vector<boost::signals2::connection>;
 
+// Containers with at least this many subcomponents index them by row so
+// that drawing and mouse lookup only visit the subcomponents that could
+// possibly be affected.  Below this, a linear scan is cheaper than the
+// index.
+constexpr std::size_t spatial_index_threshold = 16;
+
+// Subcomponents that span more than this fraction of a container's rows,
+// such as sidebars and backgrounds, are indexed apart from the rest.  A
+// lookup examines every one of them, but only need look back as far as
+// the tallest of the others for those that reach into the region.
+constexpr terminalpp::coordinate_type tall_span_divisor = 4;
+
+// The rows of a container that are occupied by one of its subcomponents.
+struct indexed_span
+{
+    terminalpp::coordinate_type first_row;
+    terminalpp::coordinate_type last_row;
+    std::size_t                 index;
+};
+
 template <class ForwardRange>
 auto find_first_focussed_component(const ForwardRange &rng)
 {
@@ -78,6 +107,19 @@ struct container::impl
     {
     }
 
+    // ======================================================================
+    // DESTRUCTOR
+    // ======================================================================
+    ~impl()
+    {
+        detail::cancel_deferred_notifications(this);
+
+        for (auto const &comp : components_)
+        {
+            component::release_layout_owner(*comp, self_);
+        }
+    }
+
     // ======================================================================
     // SET_LAYOUT
     // ======================================================================
@@ -86,7 +128,8 @@ struct container::impl
         layout_ = lyt.get() == nullptr 
                 ? make_null_layout() 
                 : std::move(lyt);
-        layout_container();
+        invalidate_layout();
+        self_.on_preferred_size_changed();
     }
 
     // ======================================================================
@@ -94,45 +137,40 @@ struct container::impl
     // ======================================================================
     void add_component(
         std::shared_ptr<component> const &comp,
-        boost::any                 const &layout_hint)
+        layout_hint                const &hint)
     {
-        component_connections cnx;
-
-        cnx.push_back(comp->on_focus_set.connect(
-            [this, wcomp = std::weak_ptr<component>(comp)]
-            {
-                this->subcomponent_focus_set_handler(wcomp);
-            }));
-
-        cnx.push_back(comp->on_focus_lost.connect(
-            [this]
-            {
-                this->subcomponent_focus_lost_handler();
-            }));
+        insert_component(comp, hint);
+        invalidate_layout();
+        self_.on_preferred_size_changed();
+    }
 
-        cnx.push_back(comp->on_cursor_state_changed.connect(
-            [this, wcomp = std::weak_ptr<component>(comp)]
-            {
-                this->subcomponent_cursor_state_change_handler(wcomp);
-            }));
+    // ======================================================================
+    // ADD_COMPONENTS
+    // ======================================================================
+    void add_components(
+        std::vector<std::shared_ptr<component>> const &comps,
+        std::vector<layout_hint>                const &hints)
+    {
+        if (comps.empty())
+        {
+            return;
+        }
 
-        cnx.push_back(comp->on_cursor_position_changed.connect(
-            [this, wcomp = std::weak_ptr<component>(comp)]
-            {
-                this->subcomponent_cursor_position_change_handler(wcomp);
-            }));
+        components_.reserve(components_.size() + comps.size());
+        hints_.reserve(hints_.size() + comps.size());
+        component_connections_.reserve(
+            component_connections_.size() + comps.size());
 
-        cnx.push_back(comp->on_redraw.connect(
-            [this, wcomp = std::weak_ptr<component>(comp)](
-                auto const &redraw_regions)
-            {
-                this->subcomponent_redraw_handler(wcomp, redraw_regions);
-            }));
+        for (auto index = size_t{0}; index < comps.size(); ++index)
+        {
+            insert_component(
+                comps[index],
+                index < hints.size() 
+                    ? hints[index] 
+                    : layout_hint());
+        }
 
-        components_.push_back(comp);
-        hints_.push_back(layout_hint);
-        component_connections_.push_back(cnx);
-        layout_container();
+        invalidate_layout();
         self_.on_preferred_size_changed();
     }
 
@@ -151,7 +189,9 @@ struct container::impl
         {
             if (components_[index] == comp)
             {
+                component::release_layout_owner(*comp, self_);
                 components_.erase(components_.begin() + index);
+                focussed_index_ = boost::none;
                 hints_.erase(hints_.begin() + index);
                 boost::for_each(
                     component_connections_[index], disconnect_connection);
@@ -161,7 +201,7 @@ struct container::impl
             }
         }
 
-        layout_container();
+        invalidate_layout();
         self_.on_preferred_size_changed();
     }
 
@@ -186,8 +226,15 @@ struct container::impl
     // ======================================================================
     void set_size(terminalpp::extent const &size)
     {
+        // Layouts size every subcomponent on every pass, so an unchanged
+        // size must not cascade into another layout of this subtree.
+        if (size == bounds_.size)
+        {
+            return;
+        }
+
         bounds_.size = size;
-        layout_container();
+        invalidate_layout();
     }
 
     // ======================================================================
@@ -241,6 +288,12 @@ struct container::impl
 
             has_focus_ = focussed_component != components_.end();
 
+            if (has_focus_)
+            {
+                focussed_index_ = 
+                    std::distance(components_.cbegin(), focussed_component);
+            }
+
             if (has_focus_)
             {
                 self_.on_focus_set();
@@ -262,12 +315,12 @@ struct container::impl
             in_focus_operation_ = false;
         };
 
-        auto focussed_component = 
-            find_first_focussed_component(components_);
+        auto *focussed_component = find_focussed_component();
 
-        if (focussed_component != components_.end())
+        if (focussed_component != nullptr)
         {
-            (*focussed_component)->lose_focus();
+            focussed_component->lose_focus();
+            focussed_index_ = boost::none;
             has_focus_ = false;
             self_.on_focus_lost();
             self_.on_cursor_state_changed();
@@ -312,11 +365,11 @@ struct container::impl
     // ======================================================================
     bool get_cursor_state() const
     {
-        auto comp = find_first_focussed_component(components_);
+        auto const *comp = find_focussed_component();
 
-        return comp == components_.end()
+        return comp == nullptr
              ? false
-             : (*comp)->get_cursor_state();
+             : comp->get_cursor_state();
     }
 
     // ======================================================================
@@ -324,11 +377,13 @@ struct container::impl
     // ======================================================================
     terminalpp::point get_cursor_position() const
     {
-        auto comp = find_first_focussed_component(components_);
+        flush_layout();
+
+        auto const *comp = find_focussed_component();
 
-        return comp == components_.end()
+        return comp == nullptr
             ? terminalpp::point{}
-            : (*comp)->get_position() + (*comp)->get_cursor_position();
+            : comp->get_position() + comp->get_cursor_position();
     }
 
     // ======================================================================
@@ -340,11 +395,13 @@ struct container::impl
         // make too much sense, but an implementation is required to fulfil the
         // component interface.  Our default implementation sets the relative
         // cursor position in the focussed component.
-        auto comp = find_first_focussed_component(components_);
+        flush_layout();
 
-        if (comp != components_.end())
+        auto *comp = find_focussed_component();
+
+        if (comp != nullptr)
         {
-            (*comp)->set_cursor_position(position - (*comp)->get_position());
+            comp->set_cursor_position(position - comp->get_position());
         }
     }
 
@@ -354,9 +411,19 @@ struct container::impl
     void draw(
         render_surface &surface, terminalpp::rectangle const &region) const
     {
-        for (auto const &comp : components_)
+        flush_layout();
+
+        if (indexed_)
         {
-            draw_component(comp, surface, region);
+            // Draw only those subcomponents that occupy rows within the
+            // region, but in the order in which they were added so that
+            // overlapping subcomponents are layered as usual.
+            draw_components(indexed_components_within(region), surface, region);
+        }
+        else
+        {
+            draw_components(
+                boost::irange(size_t{0}, components_.size()), surface, region);
         }
     }
 
@@ -371,6 +438,8 @@ struct container::impl
         // * Mouse events are passed on to the subcomponent at the location
         //   of the event, and the co-ordinates of the event are passed on
         //   relative to the subcomponent's location.
+        flush_layout();
+
         auto const *report = 
             boost::any_cast<terminalpp::ansi::mouse::report>(&ev);
 
@@ -389,6 +458,8 @@ struct container::impl
     // ======================================================================
     nlohmann::json to_json() const
     {
+        flush_layout();
+
         nlohmann::json json = {
             { "type",            "container" },
             { "position",        detail::to_json(get_position()) },
@@ -409,13 +480,370 @@ struct container::impl
         return json;
     }
 
+    // ======================================================================
+    // FIND_FOCUSSED_COMPONENT
+    // ======================================================================
+    component *find_focussed_component() const
+    {
+        // The index of the focussed subcomponent is remembered so that
+        // routing events and cursor queries down the focussed path does not
+        // require asking every subcomponent whether it has focus.  It is
+        // checked before use in case focus has moved without this 
+        // container being told.
+        if (focussed_index_ 
+         && *focussed_index_ < components_.size()
+         && components_[*focussed_index_]->has_focus())
+        {
+            return components_[*focussed_index_].get();
+        }
+
+        auto const comp = find_first_focussed_component(components_);
+
+        if (comp == components_.end())
+        {
+            focussed_index_ = boost::none;
+            return nullptr;
+        }
+
+        focussed_index_ = std::distance(components_.cbegin(), comp);
+        return comp->get();
+    }
+
+    // ======================================================================
+    // FLUSH_LAYOUT
+    // ======================================================================
+    void flush_layout() const
+    {
+        // Subcomponents may be queried, or announce new preferred sizes,
+        // while they are being laid out.  Any layout that this requires
+        // is left until the current one has finished.
+        if (in_layout_)
+        {
+            return;
+        }
+
+        if (std::exchange(layout_dirty_, false))
+        {
+            // If the whole container has not already been announced as 
+            // needing a redraw, then only those subcomponents that are 
+            // moved or resized by the layout, and whatever they uncover, 
+            // need to be redrawn.
+            auto const announce_changes = 
+                !std::exchange(layout_redraw_announced_, false);
+
+            std::vector<terminalpp::rectangle> old_bounds;
+
+            if (announce_changes)
+            {
+                old_bounds.reserve(components_.size());
+
+                for (auto const &comp : components_)
+                {
+                    old_bounds.push_back(
+                        {comp->get_position(), comp->get_size()});
+                }
+            }
+
+            {
+                in_layout_ = true;
+
+                BOOST_SCOPE_EXIT_ALL(this)
+                {
+                    in_layout_ = false;
+                };
+
+                layout_container();
+            }
+
+            if (announce_changes)
+            {
+                announce_layout_changes(old_bounds);
+            }
+        }
+    }
+
 private:
+    // ======================================================================
+    // INSERT_COMPONENT
+    // ======================================================================
+    void insert_component(
+        std::shared_ptr<component> const &comp,
+        layout_hint                const &hint)
+    {
+        component_connections cnx;
+
+        cnx.push_back(comp->on_focus_set.connect(
+            [this, wcomp = std::weak_ptr<component>(comp)]
+            {
+                this->subcomponent_focus_set_handler(wcomp);
+            }));
+
+        cnx.push_back(comp->on_focus_lost.connect(
+            [this]
+            {
+                this->subcomponent_focus_lost_handler();
+            }));
+
+        cnx.push_back(comp->on_cursor_state_changed.connect(
+            [this, wcomp = std::weak_ptr<component>(comp)]
+            {
+                this->subcomponent_cursor_state_change_handler(wcomp);
+            }));
+
+        cnx.push_back(comp->on_cursor_position_changed.connect(
+            [this, wcomp = std::weak_ptr<component>(comp)]
+            {
+                this->subcomponent_cursor_position_change_handler(wcomp);
+            }));
+
+        cnx.push_back(comp->on_preferred_size_changed.connect(
+            [this]
+            {
+                this->subcomponent_preferred_size_changed_handler();
+            }));
+
+        cnx.push_back(comp->on_redraw.connect(
+            [this, wcomp = std::weak_ptr<component>(comp)](
+                auto const &redraw_regions)
+            {
+                this->subcomponent_redraw_handler(wcomp, redraw_regions);
+            }));
+
+        cnx.push_back(comp->on_scroll.connect(
+            [this, wcomp = std::weak_ptr<component>(comp)](
+                auto const &region, auto rows)
+            {
+                return this->subcomponent_scroll_handler(wcomp, region, rows);
+            }));
+
+        components_.push_back(comp);
+        hints_.push_back(hint);
+        component_connections_.push_back(cnx);
+        component::set_layout_owner(*comp, self_);
+    }
+
     // ======================================================================
     // LAYOUT_CONTAINER
     // ======================================================================
-    void layout_container()
+    void layout_container() const
     {
         (*layout_)(components_, hints_, bounds_.size);
+        index_components();
+    }
+
+    // ======================================================================
+    // ANNOUNCE_LAYOUT_CHANGES
+    // ======================================================================
+    void announce_layout_changes(
+        std::vector<terminalpp::rectangle> const &old_bounds) const
+    {
+        auto const container_bounds = terminalpp::rectangle{{}, bounds_.size};
+        detail::region changed_region;
+
+        auto const add_visible_part = 
+            [&](terminalpp::rectangle const &rect)
+            {
+                auto const visible = 
+                    detail::intersection(rect, container_bounds);
+
+                if (visible)
+                {
+                    changed_region.add(*visible);
+                }
+            };
+
+        for (auto index = size_t{0}; index < components_.size(); ++index)
+        {
+            auto const &comp = components_[index];
+            auto const new_bounds = terminalpp::rectangle{
+                comp->get_position(), comp->get_size()};
+
+            if (new_bounds != old_bounds[index])
+            {
+                add_visible_part(old_bounds[index]);
+                add_visible_part(new_bounds);
+            }
+        }
+
+        if (!changed_region.empty())
+        {
+            auto const regions = changed_region.rectangles();
+            announce_redraw(rectangle_list(regions.begin(), regions.end()));
+        }
+    }
+
+    // ======================================================================
+    // INVALIDATE_LAYOUT
+    // ======================================================================
+    void invalidate_layout()
+    {
+        // Layout is deferred until the geometry of the subcomponents is
+        // next needed, so that a series of changes costs only one layout.
+        // At the latest, that is when the container is next drawn.  Since
+        // the set of subcomponents or the size of the container has 
+        // changed, the whole container is announced as needing a redraw.
+        layout_dirty_ = true;
+
+        if (bounds_.size.width > 0 && bounds_.size.height > 0)
+        {
+            layout_redraw_announced_ = true;
+            announce_redraw({{{}, bounds_.size}});
+        }
+    }
+
+    // ======================================================================
+    // INDEX_COMPONENTS
+    // ======================================================================
+    void index_components() const
+    {
+        row_index_.clear();
+        tall_spans_.clear();
+
+        // A null layout leaves the positioning of subcomponents to the
+        // user, who may move them at any time without the container being
+        // told, so the index could never be relied upon.
+        indexed_ = 
+            components_.size() >= spatial_index_threshold
+         && dynamic_cast<null_layout const *>(layout_.get()) == nullptr;
+
+        if (!indexed_)
+        {
+            return;
+        }
+
+        row_index_.reserve(components_.size());
+        tallest_short_span_ = 0;
+
+        auto const tall_span_rows = 
+            std::max(bounds_.size.height / tall_span_divisor, 1);
+
+        for (auto index = size_t{0}; index < components_.size(); ++index)
+        {
+            auto const &position = components_[index]->get_position();
+            auto const &size     = components_[index]->get_size();
+
+            auto const first_row = std::max(position.y, 0);
+            auto const last_row  = std::min(
+                position.y + size.height, bounds_.size.height);
+
+            if (first_row < last_row)
+            {
+                auto const rows = last_row - first_row;
+
+                if (rows > tall_span_rows)
+                {
+                    tall_spans_.push_back({first_row, last_row, index});
+                }
+                else
+                {
+                    row_index_.push_back({first_row, last_row, index});
+                    tallest_short_span_ = std::max(tallest_short_span_, rows);
+                }
+            }
+        }
+
+        // Each subcomponent is held once, however many rows it spans, in
+        // order of the first row that it occupies.
+        std::stable_sort(
+            row_index_.begin(), 
+            row_index_.end(),
+            [](auto const &lhs, auto const &rhs)
+            {
+                return lhs.first_row < rhs.first_row;
+            });
+    }
+
+    // ======================================================================
+    // INDEXED_COMPONENTS_WITHIN
+    // ======================================================================
+    std::vector<size_t> indexed_components_within(
+        terminalpp::rectangle const &region) const
+    {
+        std::vector<size_t> indices;
+
+        auto const first_row = region.origin.y;
+        auto const last_row  = region.origin.y + region.size.height;
+
+        auto const overlaps_region = 
+            [first_row, last_row](indexed_span const &span)
+            {
+                return span.first_row < last_row && span.last_row > first_row;
+            };
+
+        // No short subcomponent spans more rows than the tallest of them, 
+        // so only those that begin within that many rows above the region 
+        // can reach into it.
+        auto const by_first_row =
+            [](indexed_span const &span, terminalpp::coordinate_type row)
+            {
+                return span.first_row < row;
+            };
+
+        auto const begin = std::lower_bound(
+            row_index_.begin(), 
+            row_index_.end(), 
+            first_row - tallest_short_span_ + 1, 
+            by_first_row);
+        auto const end = std::lower_bound(
+            begin, row_index_.end(), last_row, by_first_row);
+
+        for (auto span = begin; span != end; ++span)
+        {
+            if (overlaps_region(*span))
+            {
+                indices.push_back(span->index);
+            }
+        }
+
+        for (auto const &span : tall_spans_)
+        {
+            if (overlaps_region(span))
+            {
+                indices.push_back(span.index);
+            }
+        }
+
+        std::sort(indices.begin(), indices.end());
+
+        return indices;
+    }
+
+    // ======================================================================
+    // FIND_INDEXED_COMPONENT_AT_POINT
+    // ======================================================================
+    std::shared_ptr<component> find_indexed_component_at_point(
+        terminalpp::point const &location) const
+    {
+        auto const indices = indexed_components_within({location, {1, 1}});
+        auto const &indexed_components = 
+            boost::adaptors::transform(
+                indices,
+                [this](auto index) -> std::shared_ptr<component> const &
+                {
+                    return components_[index];
+                });
+
+        auto const &comp = 
+            find_component_at_point(indexed_components, location);
+
+        return comp == boost::end(indexed_components) 
+             ? std::shared_ptr<component>{} 
+             : *comp;
+    }
+
+    // ======================================================================
+    // INDEX_OF
+    // ======================================================================
+    boost::optional<size_t> index_of(
+        std::shared_ptr<component> const &comp) const
+    {
+        auto const position = boost::find(components_, comp);
+
+        return position == components_.end()
+          ? boost::optional<size_t>{}
+          : boost::optional<size_t>{
+                static_cast<size_t>(
+                    std::distance(components_.begin(), position))};
     }
 
     // ======================================================================
@@ -451,6 +879,9 @@ private:
                 std::forward<Op>(increment_op));
 
         has_focus_ = incrementally_focussed_component != cend(components);
+        focussed_index_ = has_focus_
+          ? index_of(*incrementally_focussed_component)
+          : boost::none;
 
         // Announce a change in focus if that changed.
         if (had_focus != has_focus_)
@@ -483,55 +914,160 @@ private:
     }
 
     // ======================================================================
-    // DRAW_COMPONENT
+    // DRAW_COMPONENTS
     // ======================================================================
-    void draw_component(
-        std::shared_ptr<component> const &comp,
+    template <class IndexRange>
+    void draw_components(
+        IndexRange const &indices,
         render_surface &surface,
         terminalpp::rectangle const &region) const
     {
-        auto const component_region = terminalpp::rectangle {
-            comp->get_position(),
-            comp->get_size()
+        auto const &component_is_opaque =
+            [this](auto index)
+            {
+                return components_[index]->is_opaque();
+            };
+
+        if (boost::algorithm::none_of(indices, component_is_opaque))
+        {
+            for (auto const index : indices)
+            {
+                auto const &comp = components_[index];
+                auto const component_region = terminalpp::rectangle {
+                    comp->get_position(),
+                    comp->get_size()
+                };
+
+                auto const draw_region = 
+                    detail::intersection(component_region, region);
+
+                if (draw_region)
+                {
+                    draw_component(
+                        comp, surface, component_region, *draw_region);
+                }
+            }
+        }
+        else
+        {
+            draw_unoccluded_components(indices, surface, region);
+        }
+    }
+
+    // ======================================================================
+    // DRAW_UNOCCLUDED_COMPONENTS
+    // ======================================================================
+    template <class IndexRange>
+    void draw_unoccluded_components(
+        IndexRange const &indices,
+        render_surface &surface,
+        terminalpp::rectangle const &region) const
+    {
+        using boost::adaptors::reversed;
+
+        struct visible_component
+        {
+            size_t index;
+            terminalpp::rectangle component_region;
+            std::vector<terminalpp::rectangle> draw_regions;
         };
 
-        auto draw_region = detail::intersection(component_region, region);
+        // Work from the topmost subcomponent downwards, so that the area 
+        // covered by opaque subcomponents above each one is known by the 
+        // time it is reached.  Whatever remains of it is what will be seen.
+        std::vector<visible_component> visible_components;
+        detail::region occluded;
 
-        if (draw_region)
+        for (auto const index : indices | reversed)
         {
-            // The draw region is currently relative to this container's
-            // origin.  It should be relative to the child's origin.
-            draw_region->origin -= component_region.origin;
+            auto const &comp = components_[index];
+            auto const component_region = terminalpp::rectangle {
+                comp->get_position(),
+                comp->get_size()
+            };
 
-            // The canvas must have an offset applied to it so that the
-            // inner component can pretend that it is being drawn with its
-            // container being at position (0,0).
-            surface.offset_by({
-                component_region.origin.x,
-                component_region.origin.y
-            });
+            auto const draw_region = 
+                detail::intersection(component_region, region);
 
-            // Ensure that the offset is unapplied before exit of this
-            // function.
-            BOOST_SCOPE_EXIT_ALL(&surface, &component_region)
+            if (!draw_region)
             {
-                surface.offset_by({
-                    -component_region.origin.x,
-                    -component_region.origin.y
-                });
-            };
+                continue;
+            }
 
-            comp->draw(surface, draw_region.get());
+            detail::region visible;
+            visible.add(*draw_region);
+
+            for (auto const &rect : occluded.rectangles())
+            {
+                visible.subtract(rect);
+            }
+
+            if (!visible.empty())
+            {
+                visible_components.push_back(
+                    {index, component_region, visible.rectangles()});
+            }
+
+            if (comp->is_opaque())
+            {
+                occluded.add(*draw_region);
+            }
         }
+
+        for (auto const &visible_comp : visible_components | reversed)
+        {
+            for (auto const &draw_region : visible_comp.draw_regions)
+            {
+                draw_component(
+                    components_[visible_comp.index], 
+                    surface, 
+                    visible_comp.component_region, 
+                    draw_region);
+            }
+        }
+    }
+
+    // ======================================================================
+    // DRAW_COMPONENT
+    // ======================================================================
+    void draw_component(
+        std::shared_ptr<component> const &comp,
+        render_surface &surface,
+        terminalpp::rectangle const &component_region,
+        terminalpp::rectangle draw_region) const
+    {
+        // The draw region is currently relative to this container's
+        // origin.  It should be relative to the child's origin.
+        draw_region.origin -= component_region.origin;
+
+        // The surface is clipped to the bounds of the inner component
+        // and given that component's origin as its basis, so that the
+        // component can pretend that it is being drawn at position 
+        // (0,0), and cannot draw over its siblings.
+        render_surface::scoped_clip const clip(surface, component_region);
+
+        comp->draw(surface, draw_region);
     }
 
     // ======================================================================
     // SUBCOMPONENT_REDRAW_HANDLER
     // ======================================================================
     void subcomponent_redraw_handler(
-        std::weak_ptr<component>           weak_subcomponent,
-        std::vector<terminalpp::rectangle> regions)
+        std::weak_ptr<component> weak_subcomponent,
+        rectangle_list           regions)
     {
+        // Subcomponents being moved and resized by the layout may request
+        // redraws, but wherever a layout moves or resizes a subcomponent
+        // is announced as needing a redraw anyway, so these add nothing.
+        if (in_layout_)
+        {
+            return;
+        }
+
+        // Otherwise, the position of the subcomponent must be current in
+        // order to translate its regions.
+        flush_layout();
+
         auto subcomponent = weak_subcomponent.lock();
 
         if (subcomponent != NULL)
@@ -539,20 +1075,143 @@ private:
             // Each region is bound to the origin of the component in question.
             // It must be rebound to the origin of the container.  We do this
             // by offsetting the regions' origins by the origin of the
-            // subcomponent within this container.
-            auto origin = subcomponent->get_position();
+            // subcomponent within this container.  Components may announce
+            // regions larger than themselves, and may lie partly outside the
+            // container, so each region is also clipped to the part of the
+            // container that the subcomponent actually covers.
+            auto const origin = subcomponent->get_position();
+            auto const visible_region = detail::intersection(
+                terminalpp::rectangle{origin, subcomponent->get_size()},
+                terminalpp::rectangle{{}, bounds_.size});
+
+            if (!visible_region)
+            {
+                return;
+            }
 
-            for (auto &rect : regions)
+            auto clipped_end = regions.begin();
+
+            for (auto rect : regions)
             {
                 rect.origin.x += origin.x;
                 rect.origin.y += origin.y;
+
+                auto const clipped_rect = 
+                    detail::intersection(rect, *visible_region);
+
+                if (clipped_rect)
+                {
+                    *clipped_end++ = *clipped_rect;
+                }
             }
 
+            regions.erase(clipped_end, regions.end());
+
             // This new information must be passed up the component heirarchy.
+            if (!regions.empty())
+            {
+                announce_redraw(regions);
+            }
+        }
+    }
+
+    // ======================================================================
+    // SUBCOMPONENT_SCROLL_HANDLER
+    // ======================================================================
+    bool subcomponent_scroll_handler(
+        std::weak_ptr<component>    weak_subcomponent,
+        terminalpp::rectangle       region,
+        terminalpp::coordinate_type rows)
+    {
+        // Anything that a layout moves or resizes is redrawn afterwards, 
+        // so there is nothing to move.
+        if (in_layout_)
+        {
+            return true;
+        }
+
+        flush_layout();
+
+        auto subcomponent = weak_subcomponent.lock();
+
+        if (subcomponent == nullptr)
+        {
+            return false;
+        }
+
+        region.origin.x += subcomponent->get_position().x;
+        region.origin.y += subcomponent->get_position().y;
+
+        // What was drawn may only be moved if all of it belongs to the
+        // subcomponent.  If any of the region is out of sight, or shared
+        // with another subcomponent, then it must be redrawn instead.
+        auto const region_is_within = 
+            [&region](terminalpp::rectangle const &bounds)
+            {
+                auto const overlap = detail::intersection(region, bounds);
+                return overlap && *overlap == region;
+            };
+
+        auto const overlaps_region = 
+            [&region, &subcomponent](auto const &comp)
+            {
+                return comp != subcomponent
+                    && detail::intersection(
+                           region, 
+                           {comp->get_position(), comp->get_size()});
+            };
+
+        if (!region_is_within({{}, bounds_.size})
+         || !region_is_within(
+                {subcomponent->get_position(), subcomponent->get_size()})
+         || boost::algorithm::any_of(components_, overlaps_region))
+        {
+            return false;
+        }
+
+        // Any redraws that are waiting to be announced describe parts of
+        // the region before it moved, so they must move with it.
+        deferred_redraw_region_.scroll(region, rows);
+
+        return self_.on_scroll(region, rows).get_value_or(false);
+    }
+
+    // ======================================================================
+    // ANNOUNCE_REDRAW
+    // ======================================================================
+    void announce_redraw(rectangle_list const &regions) const
+    {
+        if (detail::notifications_are_deferred())
+        {
+            for (auto const &rect : regions)
+            {
+                deferred_redraw_region_.add(rect);
+            }
+
+            schedule_deferred_notifications();
+        }
+        else
+        {
             self_.on_redraw(regions);
         }
     }
 
+    // ======================================================================
+    // SUBCOMPONENT_PREFERRED_SIZE_CHANGED_HANDLER
+    // ======================================================================
+    void subcomponent_preferred_size_changed_handler()
+    {
+        // The geometry of the subcomponents depends on their preferred
+        // sizes, so they must be laid out again even if this container is
+        // not resized.  Nothing is announced until then, since only those
+        // that the layout actually moves need to be redrawn; the 
+        // subcomponent redraws whatever changed within itself, and that
+        // is when the layout is flushed.  Its own preferred size is 
+        // derived from theirs, and so changes along with them.
+        layout_dirty_ = true;
+        self_.on_preferred_size_changed();
+    }
+
     // ======================================================================
     // SUBCOMPONENT_FOCUS_SET_HANDLER
     // ======================================================================
@@ -561,8 +1220,11 @@ private:
     {
         if (!in_focus_operation_)
         {
+            auto const orig = weak_comp.lock();
+            focussed_index_ = orig ? index_of(orig) : boost::none;
+
             auto const &another_component_has_focus = 
-                [orig = weak_comp.lock()](auto const &comp)
+                [&orig](auto const &comp)
                 {
                     return comp != orig && comp->has_focus();
                 };
@@ -599,6 +1261,7 @@ private:
     {
         if (!in_focus_operation_)
         {
+            focussed_index_ = boost::none;
             has_focus_ = false;
             self_.on_focus_lost();
         }
@@ -614,7 +1277,15 @@ private:
 
         if (subcomponent && subcomponent->has_focus())
         {
-            self_.on_cursor_state_changed();
+            if (detail::notifications_are_deferred())
+            {
+                deferred_cursor_state_change_ = true;
+                schedule_deferred_notifications();
+            }
+            else
+            {
+                self_.on_cursor_state_changed();
+            }
         }
     }
 
@@ -627,6 +1298,51 @@ private:
         auto subcomponent = weak_subcomponent.lock();
 
         if (subcomponent && subcomponent->has_focus())
+        {
+            if (detail::notifications_are_deferred())
+            {
+                deferred_cursor_position_change_ = true;
+                schedule_deferred_notifications();
+            }
+            else
+            {
+                self_.on_cursor_position_changed();
+            }
+        }
+    }
+
+    // ======================================================================
+    // SCHEDULE_DEFERRED_NOTIFICATIONS
+    // ======================================================================
+    void schedule_deferred_notifications() const
+    {
+        if (!std::exchange(deferred_notifications_scheduled_, true))
+        {
+            detail::defer_notification(
+                this, [this]{ announce_deferred_notifications(); });
+        }
+    }
+
+    // ======================================================================
+    // ANNOUNCE_DEFERRED_NOTIFICATIONS
+    // ======================================================================
+    void announce_deferred_notifications() const
+    {
+        deferred_notifications_scheduled_ = false;
+
+        if (!deferred_redraw_region_.empty())
+        {
+            auto const regions = deferred_redraw_region_.rectangles();
+            deferred_redraw_region_.clear();
+            self_.on_redraw(rectangle_list(regions.begin(), regions.end()));
+        }
+
+        if (std::exchange(deferred_cursor_state_change_, false))
+        {
+            self_.on_cursor_state_changed();
+        }
+
+        if (std::exchange(deferred_cursor_position_change_, false))
         {
             self_.on_cursor_position_changed();
         }
@@ -637,11 +1353,11 @@ private:
     // ======================================================================
     void handle_common_event(boost::any const &event)
     {
-        auto comp = find_first_focussed_component(components_);
+        auto *comp = find_focussed_component();
 
-        if (comp != components_.end())
+        if (comp != nullptr)
         {
-            (*comp)->event(event);
+            comp->event(event);
         }
     }
 
@@ -650,15 +1366,30 @@ private:
     // ======================================================================
     void handle_mouse_event(terminalpp::ansi::mouse::report const &report)
     {
-        auto const &comp = find_component_at_point(
-            components_,
-            terminalpp::point(report.x_position_, report.y_position_));
+        auto const location = 
+            terminalpp::point(report.x_position_, report.y_position_);
 
-        if (comp != components_.end())
+        std::shared_ptr<component> comp;
+
+        if (indexed_)
+        {
+            comp = find_indexed_component_at_point(location);
+        }
+        else
         {
-            auto const &position = (*comp)->get_position();
+            auto const &found = find_component_at_point(components_, location);
 
-            (*comp)->event(
+            if (found != components_.end())
+            {
+                comp = *found;
+            }
+        }
+
+        if (comp)
+        {
+            auto const &position = comp->get_position();
+
+            comp->event(
                 terminalpp::ansi::mouse::report {
                     report.button_,
                     report.x_position_ - position.x,
@@ -671,10 +1402,33 @@ private:
     terminalpp::rectangle                    bounds_;
     std::unique_ptr<munin::layout>           layout_ = make_null_layout();
     std::vector<std::shared_ptr<component>>  components_;
-    std::vector<boost::any>                  hints_;
+    std::vector<layout_hint>                 hints_;
     std::vector<component_connections>       component_connections_;
     bool                                     has_focus_ = false;
     bool                                     in_focus_operation_ = false;
+    mutable boost::optional<size_t>          focussed_index_;
+
+    // Layout is performed lazily, and the index of subcomponents by row is
+    // rebuilt alongside it, so these are all updated from const functions.
+    mutable bool                             layout_dirty_ = false;
+    mutable bool                             layout_redraw_announced_ = false;
+    mutable bool                             in_layout_ = false;
+
+    // The rows occupied by each short subcomponent as of the most recent
+    // layout, ordered by the first of those rows, and the most rows that 
+    // any one of them occupies.  Tall subcomponents are held separately,
+    // so that one of them does not lengthen every lookup.
+    mutable std::vector<indexed_span>        row_index_;
+    mutable terminalpp::coordinate_type      tallest_short_span_ = 0;
+    mutable std::vector<indexed_span>        tall_spans_;
+    mutable bool                             indexed_ = false;
+
+    // Notifications may be deferred by a lazy layout, which takes place
+    // in const functions, and so these are mutable too.
+    mutable detail::region                   deferred_redraw_region_;
+    mutable bool                             deferred_cursor_state_change_ = false;
+    mutable bool                             deferred_cursor_position_change_ = false;
+    mutable bool                             deferred_notifications_scheduled_ = false;
 };
 
 // ==========================================================================
@@ -705,9 +1459,27 @@ void container::set_layout(std::unique_ptr<munin::layout> &&lyt)
 // ==========================================================================
 void container::add_component(
     std::shared_ptr<component> const &comp,
-    boost::any                 const &layout_hint)
+    layout_hint                const &hint)
+{
+    pimpl_->add_component(comp, hint);
+}
+
+// ==========================================================================
+// ADD_COMPONENTS
+// ==========================================================================
+void container::add_components(
+    std::vector<std::shared_ptr<component>> const &comps,
+    std::vector<layout_hint>                const &hints)
 {
-    pimpl_->add_component(comp, layout_hint);
+    pimpl_->add_components(comps, hints);
+}
+
+// ==========================================================================
+// FLUSH_LAYOUT
+// ==========================================================================
+void container::flush_layout()
+{
+    pimpl_->flush_layout();
 }
 
 // ==========================================================================
@@ -847,6 +1619,14 @@ nlohmann::json container::do_to_json() const
     return pimpl_->to_json();
 }
 
+// ==========================================================================
+// DO_FLUSH_LAYOUT
+// ==========================================================================
+void container::do_flush_layout() const
+{
+    pimpl_->flush_layout();
+}
+
 // ==========================================================================
 // MAKE_CONTAINER
 // ==========================================================================
@@ -72,5 +72,45 @@ boost::optional<terminalpp::rectangle> intersection(
     return overlap;
 }
 
+// ==========================================================================
+// SCROLL_CANVAS
+// ==========================================================================
+void scroll_canvas(
+    terminalpp::canvas          &cvs,
+    terminalpp::rectangle const &region,
+    terminalpp::coordinate_type  rows)
+{
+    auto const top    = region.origin.y;
+    auto const bottom = region.origin.y + region.size.height;
+    auto const left   = region.origin.x;
+    auto const right  = region.origin.x + region.size.width;
+
+    auto const copy_row = 
+        [&cvs, left, right](auto from, auto to)
+        {
+            for (auto column = left; column < right; ++column)
+            {
+                cvs[column][to] = cvs[column][from];
+            }
+        };
+
+    // Rows are copied in the direction of travel so that no row is
+    // overwritten before it has been copied.
+    if (rows > 0)
+    {
+        for (auto row = top; row + rows < bottom; ++row)
+        {
+            copy_row(row + rows, row);
+        }
+    }
+    else if (rows < 0)
+    {
+        for (auto row = bottom - 1; row + rows >= top; --row)
+        {
+            copy_row(row + rows, row);
+        }
+    }
+}
+
 }}
 
@@ -0,0 +1,103 @@
+#include "munin/detail/deferred_notifications.hpp"
+#include <boost/range/algorithm/remove_if.hpp>
+#include <boost/scope_exit.hpp>
+#include <deque>
+#include <utility>
+
+namespace munin { namespace detail {
+
+namespace {
+
+struct deferred_notification
+{
+    void const *owner;
+    std::function<void ()> notification;
+};
+
+struct deferral_state
+{
+    int depth = 0;
+    std::deque<deferred_notification> notifications;
+};
+
+// ==========================================================================
+// GET_DEFERRAL_STATE
+// ==========================================================================
+deferral_state &get_deferral_state()
+{
+    static thread_local deferral_state state;
+    return state;
+}
+
+}
+
+// ==========================================================================
+// BEGIN_DEFERRING_NOTIFICATIONS
+// ==========================================================================
+void begin_deferring_notifications()
+{
+    ++get_deferral_state().depth;
+}
+
+// ==========================================================================
+// END_DEFERRING_NOTIFICATIONS
+// ==========================================================================
+void end_deferring_notifications()
+{
+    auto &state = get_deferral_state();
+
+    BOOST_SCOPE_EXIT_ALL(&state)
+    {
+        --state.depth;
+    };
+
+    if (state.depth == 1)
+    {
+        // Notifications remain deferred while they are being announced, so
+        // that any that are caused by these are added to the end of the 
+        // queue and accumulated with any others from the same owner.
+        while (!state.notifications.empty())
+        {
+            auto const next = std::move(state.notifications.front());
+            state.notifications.pop_front();
+            next.notification();
+        }
+    }
+}
+
+// ==========================================================================
+// NOTIFICATIONS_ARE_DEFERRED
+// ==========================================================================
+bool notifications_are_deferred()
+{
+    return get_deferral_state().depth != 0;
+}
+
+// ==========================================================================
+// DEFER_NOTIFICATION
+// ==========================================================================
+void defer_notification(
+    void const *owner, std::function<void ()> notification)
+{
+    get_deferral_state().notifications.push_back(
+        {owner, std::move(notification)});
+}
+
+// ==========================================================================
+// CANCEL_DEFERRED_NOTIFICATIONS
+// ==========================================================================
+void cancel_deferred_notifications(void const *owner)
+{
+    auto &notifications = get_deferral_state().notifications;
+
+    notifications.erase(
+        boost::remove_if(
+            notifications,
+            [owner](auto const &deferred)
+            {
+                return deferred.owner == owner;
+            }),
+        notifications.end());
+}
+
+}}
@@ -0,0 +1,288 @@
+#include "munin/detail/region.hpp"
+#include "munin/detail/algorithm.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace munin { namespace detail {
+
+namespace {
+
+// ==========================================================================
+// MERGE_SPAN
+// ==========================================================================
+template <class Span>
+void merge_span(std::vector<Span> &spans, Span added)
+{
+    std::vector<Span> result;
+    result.reserve(spans.size() + 1);
+
+    bool added_is_placed = false;
+
+    for (auto const &current : spans)
+    {
+        if (current.end < added.begin)
+        {
+            // The current span is entirely to the left of the added span,
+            // and does not abut it.
+            result.push_back(current);
+        }
+        else if (added.end < current.begin)
+        {
+            // The current span is entirely to the right of the added span,
+            // so the added span (possibly grown by merges) goes first.
+            if (!added_is_placed)
+            {
+                result.push_back(added);
+                added_is_placed = true;
+            }
+
+            result.push_back(current);
+        }
+        else
+        {
+            // The spans overlap or abut, and so become one span.
+            added.begin = (std::min)(added.begin, current.begin);
+            added.end   = (std::max)(added.end, current.end);
+        }
+    }
+
+    if (!added_is_placed)
+    {
+        result.push_back(added);
+    }
+
+    spans.swap(result);
+}
+
+// ==========================================================================
+// SUBTRACT_SPAN
+// ==========================================================================
+template <class Span>
+void subtract_span(std::vector<Span> &spans, Span removed)
+{
+    std::vector<Span> result;
+    result.reserve(spans.size() + 1);
+
+    for (auto const &current : spans)
+    {
+        if (current.end <= removed.begin || removed.end <= current.begin)
+        {
+            // The spans do not overlap, and so the current span is kept
+            // intact.
+            result.push_back(current);
+        }
+        else
+        {
+            // Keep whatever of the current span lies either side of the
+            // removed span.
+            if (current.begin < removed.begin)
+            {
+                result.push_back({current.begin, removed.begin});
+            }
+
+            if (removed.end < current.end)
+            {
+                result.push_back({removed.end, current.end});
+            }
+        }
+    }
+
+    spans.swap(result);
+}
+
+// ==========================================================================
+// SPANS_ARE_EQUAL
+// ==========================================================================
+template <class Span>
+bool spans_are_equal(
+    std::vector<Span> const &lhs, std::vector<Span> const &rhs)
+{
+    return std::equal(
+        lhs.begin(), lhs.end(),
+        rhs.begin(), rhs.end(),
+        [](auto const &lhs_span, auto const &rhs_span)
+        {
+            return lhs_span.begin == rhs_span.begin
+                && lhs_span.end   == rhs_span.end;
+        });
+}
+
+}
+
+// ==========================================================================
+// ADD
+// ==========================================================================
+void region::add(terminalpp::rectangle const &rect)
+{
+    apply(
+        rect,
+        [](std::vector<span> &spans, span const &added)
+        {
+            merge_span(spans, added);
+        });
+}
+
+// ==========================================================================
+// SUBTRACT
+// ==========================================================================
+void region::subtract(terminalpp::rectangle const &rect)
+{
+    if (bands_.empty())
+    {
+        return;
+    }
+
+    apply(
+        rect,
+        [](std::vector<span> &spans, span const &removed)
+        {
+            subtract_span(spans, removed);
+        });
+}
+
+// ==========================================================================
+// SCROLL
+// ==========================================================================
+void region::scroll(
+    terminalpp::rectangle const &area, terminalpp::coordinate_type rows)
+{
+    if (rows == 0)
+    {
+        return;
+    }
+
+    for (auto rect : rectangles())
+    {
+        auto const affected_rect = intersection(rect, area);
+
+        if (affected_rect)
+        {
+            rect = *affected_rect;
+            rect.origin.y -= rows;
+
+            auto const scrolled_rect = intersection(rect, area);
+
+            if (scrolled_rect)
+            {
+                add(*scrolled_rect);
+            }
+        }
+    }
+}
+
+// ==========================================================================
+// APPLY
+// ==========================================================================
+template <class SpanOperation>
+void region::apply(terminalpp::rectangle const &rect, SpanOperation &&op)
+{
+    if (rect.size.width <= 0 || rect.size.height <= 0)
+    {
+        return;
+    }
+
+    auto const top     = rect.origin.y;
+    auto const bottom  = rect.origin.y + rect.size.height;
+    auto const columns = span{rect.origin.x, rect.origin.x + rect.size.width};
+
+    // Collect every row at which the shape of the region might change.
+    // Between each consecutive pair of these, the spans are constant.
+    std::vector<terminalpp::coordinate_type> edges{top, bottom};
+    edges.reserve((bands_.size() * 2) + 2);
+
+    for (auto const &current : bands_)
+    {
+        edges.push_back(current.top);
+        edges.push_back(current.bottom);
+    }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector<band> result;
+    result.reserve(edges.size());
+
+    auto current = bands_.begin();
+
+    for (auto edge = edges.begin(); edge + 1 != edges.end(); ++edge)
+    {
+        auto const band_top    = *edge;
+        auto const band_bottom = *(edge + 1);
+
+        while (current != bands_.end() && current->bottom <= band_top)
+        {
+            ++current;
+        }
+
+        std::vector<span> spans;
+
+        if (current != bands_.end() && current->top <= band_top)
+        {
+            spans = current->spans;
+        }
+
+        if (band_top >= top && band_top < bottom)
+        {
+            op(spans, columns);
+        }
+
+        if (spans.empty())
+        {
+            continue;
+        }
+
+        // If this band continues directly on from the previous one with
+        // exactly the same spans, then they are coalesced into one band.
+        if (!result.empty()
+         && result.back().bottom == band_top
+         && spans_are_equal(result.back().spans, spans))
+        {
+            result.back().bottom = band_bottom;
+        }
+        else
+        {
+            result.push_back({band_top, band_bottom, std::move(spans)});
+        }
+    }
+
+    bands_.swap(result);
+}
+
+// ==========================================================================
+// CLEAR
+// ==========================================================================
+void region::clear()
+{
+    bands_.clear();
+}
+
+// ==========================================================================
+// EMPTY
+// ==========================================================================
+bool region::empty() const
+{
+    return bands_.empty();
+}
+
+// ==========================================================================
+// RECTANGLES
+// ==========================================================================
+std::vector<terminalpp::rectangle> region::rectangles() const
+{
+    std::vector<terminalpp::rectangle> result;
+
+    for (auto const &current : bands_)
+    {
+        for (auto const &columns : current.spans)
+        {
+            result.push_back({
+                { columns.begin, current.top },
+                { columns.end - columns.begin, current.bottom - current.top }
+            });
+        }
+    }
+
+    return result;
+}
+
+}}
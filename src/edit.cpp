@@ -208,6 +208,7 @@ private:
             auto const erased_content = 
                 content.begin() + (cursor_position.x - 1);
             content.erase(erased_content, erased_content + 1);
+            self_.on_preferred_size_changed();
     
             self_.set_cursor_position({
                 cursor_position.x - 1,
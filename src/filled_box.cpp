@@ -1,6 +1,5 @@
 #include "munin/filled_box.hpp"
 #include "munin/render_surface.hpp"
-#include <terminalpp/algorithm/for_each_in_region.hpp>
 
 namespace munin {
 
@@ -52,17 +51,15 @@ terminalpp::extent filled_box::do_get_preferred_size() const
 void filled_box::do_draw(
     render_surface &surface, terminalpp::rectangle const &region) const
 {
-    auto const element = fill_function_(surface);
-    
-    terminalpp::for_each_in_region(
-        surface,
-        region,
-        [&element](terminalpp::element &elem, 
-                   terminalpp::coordinate_type column, 
-                   terminalpp::coordinate_type row)
-        {
-            elem = element;
-        });
+    surface.fill_rect(region, fill_function_(surface));
+}
+
+// ==========================================================================
+// DO_IS_OPAQUE
+// ==========================================================================
+bool filled_box::do_is_opaque() const
+{
+    return true;
 }
 
 // ==========================================================================
@@ -0,0 +1,112 @@
+#include "munin/flex_layout.hpp"
+#include "munin/component.hpp"
+#include "munin/detail/flex_solver.hpp"
+#include <algorithm>
+
+namespace munin {
+
+namespace {
+
+// ==========================================================================
+// TRACK_OF
+// ==========================================================================
+flex_track const &track_of(
+    std::vector<layout_hint> const &hints, std::size_t index)
+{
+    static constexpr flex_track const default_track = preferred_track();
+
+    auto const *track = index < hints.size()
+                      ? boost::get<flex_track>(&hints[index])
+                      : nullptr;
+
+    return track != nullptr ? *track : default_track;
+}
+
+}
+
+// ==========================================================================
+// CONSTRUCTOR
+// ==========================================================================
+flex_layout::flex_layout(flex_direction direction)
+  : direction_(direction)
+{
+}
+
+// ==========================================================================
+// DO_GET_PREFERRED_SIZE
+// ==========================================================================
+terminalpp::extent flex_layout::do_get_preferred_size(
+    std::vector<std::shared_ptr<component>> const &components,
+    std::vector<layout_hint>                const &hints) const
+{
+    // Along the main axis, the preferred size is the sum of the tracks at
+    // their preferred sizes.  Across it, it is that of the largest
+    // component.
+    auto main  = terminalpp::coordinate_type{0};
+    auto cross = terminalpp::coordinate_type{0};
+
+    for (auto index = std::size_t{0}; index < components.size(); ++index)
+    {
+        auto const preferred_size = components[index]->get_preferred_size();
+
+        main += detail::preferred_track_size(
+            track_of(hints, index), 
+            detail::main_axis(preferred_size, direction_));
+
+        cross = (std::max)(
+            cross, detail::cross_axis(preferred_size, direction_));
+    }
+
+    return detail::make_flex_extent(main, cross, direction_);
+}
+
+// ==========================================================================
+// DO_LAYOUT
+// ==========================================================================
+void flex_layout::do_layout(
+    std::vector<std::shared_ptr<component>> const &components,
+    std::vector<layout_hint>                const &hints,
+    terminalpp::extent                             size) const
+{
+    auto const cross_size = detail::cross_axis(size, direction_);
+
+    detail::solve_flex_tracks(
+        components.size(),
+        detail::main_axis(size, direction_),
+        [&hints](auto index) -> flex_track const &
+        {
+            return track_of(hints, index);
+        },
+        [this, &components](auto index)
+        {
+            return detail::main_axis(
+                components[index]->get_preferred_size(), direction_);
+        },
+        [this, &components, cross_size](auto index, auto position, auto size)
+        {
+            auto &comp = *components[index];
+            comp.set_position(detail::make_flex_point(position, 0, direction_));
+            comp.set_size(detail::make_flex_extent(size, cross_size, direction_));
+        });
+}
+
+// ==========================================================================
+// DO_TO_JSON
+// ==========================================================================
+nlohmann::json flex_layout::do_to_json() const
+{
+    return {
+        { "type",      "flex_layout" },
+        { "direction", direction_ == flex_direction::row ? "row" : "column" }
+    };
+}
+
+// ==========================================================================
+// MAKE_FLEX_LAYOUT
+// ==========================================================================
+std::unique_ptr<layout> make_flex_layout(flex_direction direction)
+{
+    return std::unique_ptr<layout>(new flex_layout(direction));
+}
+
+}
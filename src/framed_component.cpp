@@ -15,7 +15,7 @@ protected :
     //* =====================================================================
     terminalpp::extent do_get_preferred_size(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints) const override
+        std::vector<layout_hint>                const &hints) const override
     {
         auto outer_frame = std::static_pointer_cast<frame>(components[0]);
         auto inner_preferred_size = components[1]->get_preferred_size();
@@ -37,7 +37,7 @@ protected :
     //* =====================================================================
     void do_layout(
         std::vector<std::shared_ptr<component>> const &components,
-        std::vector<boost::any>                 const &hints,
+        std::vector<layout_hint>                const &hints,
         terminalpp::extent                             size) const override
     {
         auto const &outer_frame = std::static_pointer_cast<frame>(components[0]);
@@ -102,6 +102,15 @@ framed_component::framed_component(
     frame_->highlight_on_focus(inner_component_);
 }
 
+// ==========================================================================
+// DO_SET_SIZE
+// ==========================================================================
+void framed_component::do_set_size(terminalpp::extent const &size)
+{
+    composite_component::do_set_size(size);
+    flush_layout();
+}
+
 // ==========================================================================
 // DO_EVENT
 // ==========================================================================
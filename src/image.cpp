@@ -1,6 +1,8 @@
 #include "munin/image.hpp"
+#include "munin/detail/algorithm.hpp"
 #include "munin/detail/json_adaptors.hpp"
 #include "munin/render_surface.hpp"
+#include <boost/algorithm/clamp.hpp>
 #include <boost/make_unique.hpp>
 #include <algorithm>
 #include <utility>
@@ -70,7 +72,7 @@ static bool has_zero_dimension(terminalpp::rectangle const &bounds)
 // ADD_REDRAW_REGION
 // ==========================================================================
 static void add_redraw_region(
-    std::vector<terminalpp::rectangle> &redraw_regions,
+    rectangle_list &redraw_regions,
     terminalpp::extent const &component_size,
     terminalpp::extent const &content_size)
 {
@@ -93,12 +95,7 @@ static void draw_fill_line(
     terminalpp::coordinate_type const &width,
     terminalpp::element const &fill)
 {
-    for (terminalpp::coordinate_type column = origin.x;
-         column < origin.x + width;
-         ++column)
-    {
-        surface[column][origin.y] = fill;
-    }
+    surface.fill_row(origin, width, fill);
 }
 
 // ==========================================================================
@@ -112,17 +109,23 @@ static void draw_content_line(
     terminalpp::string const &content,
     terminalpp::element const &fill)
 {
-    for (auto column = origin.x; column < origin.x + line_width; ++column)
-    {
-        bool const column_has_content =
-            column >= content_start
-         && column <  content_start + content.size();
-
-        surface[column][origin.y] =
-            column_has_content
-          ? content[column - content_start]
-          : fill;
-    }
+    // The line is split into three runs: the fill to the left of the
+    // content, the visible part of the content, and the fill to its right.
+    auto const line_end = origin.x + line_width;
+    auto const content_end = 
+        content_start + terminalpp::coordinate_type(content.size());
+    
+    auto const text_begin = 
+        boost::algorithm::clamp(content_start, origin.x, line_end);
+    auto const text_end = 
+        boost::algorithm::clamp(content_end, text_begin, line_end);
+
+    surface.fill_row(origin, text_begin - origin.x, fill);
+    surface.write_row(
+        { text_begin, origin.y },
+        content.begin() + (text_begin - content_start),
+        content.begin() + (text_end - content_start));
+    surface.fill_row({ text_end, origin.y }, line_end - text_end, fill);
 }
 
 // ==========================================================================
@@ -217,14 +220,16 @@ void image::set_content(std::vector<terminalpp::string> const &content)
         return;
     }
 
-    std::vector<terminalpp::rectangle> redraw_regions;
+    rectangle_list redraw_regions;
     auto const size = get_size();
 
+    // The preferred size is announced as changed before it is used to
+    // calculate the new content bounds, so that it is not out of date.
     add_redraw_region(redraw_regions, size, get_preferred_size());
     pimpl_->content_ = content;
+    on_preferred_size_changed();
     add_redraw_region(redraw_regions, size, get_preferred_size());
 
-    on_preferred_size_changed();
     on_redraw(redraw_regions);
 }
 
@@ -268,12 +273,22 @@ terminalpp::extent image::do_get_preferred_size() const
 void image::do_draw(
     render_surface &surface, terminalpp::rectangle const &region) const
 {
+    // Only the part of the region that will not be clipped away needs to
+    // be drawn.
+    auto const visible_region = 
+        detail::intersection(region, surface.clip_region());
+
+    if (!visible_region)
+    {
+        return;
+    }
+
     auto const size = get_size();
     auto const content_size = get_preferred_size();
     auto const content_basis = get_content_basis(size, content_size);
 
-    for (terminalpp::coordinate_type row = region.origin.y;
-         row < region.origin.y + region.size.height;
+    for (terminalpp::coordinate_type row = visible_region->origin.y;
+         row < visible_region->origin.y + visible_region->size.height;
          ++row)
     {
         bool const row_has_content =
@@ -284,9 +299,9 @@ void image::do_draw(
         {
             draw_content_line(
                 surface,
-                { region.origin.x, row },
+                { visible_region->origin.x, row },
                 content_basis.x,
-                region.size.width,
+                visible_region->size.width,
                 pimpl_->content_[row - content_basis.y],
                 pimpl_->fill_);
         }
@@ -294,8 +309,8 @@ void image::do_draw(
         {
             draw_fill_line(
                 surface,
-                { region.origin.x, row },
-                region.size.width,
+                { visible_region->origin.x, row },
+                visible_region->size.width,
                 pimpl_->fill_);
         }
     }
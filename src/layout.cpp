@@ -8,7 +8,7 @@ namespace munin {
 // ==========================================================================
 terminalpp::extent layout::get_preferred_size(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints) const
+    std::vector<layout_hint>                const &hints) const
 {
     assert(hints.size() == 0 || hints.size() == components.size());
     return do_get_preferred_size(components, hints);
@@ -19,7 +19,7 @@ terminalpp::extent layout::get_preferred_size(
 // ==========================================================================
 void layout::operator()(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints,
+    std::vector<layout_hint>                const &hints,
     terminalpp::extent                             size) const
 {
     assert(hints.size() == 0 || hints.size() == components.size());
@@ -7,7 +7,7 @@ namespace munin {
 // ==========================================================================
 terminalpp::extent null_layout::do_get_preferred_size(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints) const
+    std::vector<layout_hint>                const &hints) const
 {
     return {};
 }
@@ -17,7 +17,7 @@ terminalpp::extent null_layout::do_get_preferred_size(
 // ==========================================================================
 void null_layout::do_layout(
     std::vector<std::shared_ptr<component>> const &components,
-    std::vector<boost::any>                 const &hints,
+    std::vector<layout_hint>                const &hints,
     terminalpp::extent                             size) const
 {
 }
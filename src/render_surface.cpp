@@ -1,4 +1,6 @@
 #include "munin/render_surface.hpp"
+#include "munin/detail/algorithm.hpp"
+#include <algorithm>
 
 namespace munin {
 namespace {
@@ -23,6 +25,39 @@ static default_render_surface_capabilities default_capabilities;
 
 }
 
+// ==========================================================================
+// SCOPED_CLIP::CONSTRUCTOR
+// ==========================================================================
+render_surface::scoped_clip::scoped_clip(
+    render_surface &surface,
+    terminalpp::rectangle const &region)
+  : surface_(surface),
+    previous_offset_(surface.offset_),
+    previous_clip_(surface.clip_)
+{
+    auto const canvas_region = terminalpp::rectangle{
+        { 
+            region.origin.x + surface_.offset_.width,
+            region.origin.y + surface_.offset_.height
+        },
+        region.size
+    };
+
+    surface_.clip_ = 
+        detail::intersection(surface_.clip_, canvas_region)
+            .value_or(terminalpp::rectangle{});
+    surface_.offset_by({region.origin.x, region.origin.y});
+}
+
+// ==========================================================================
+// SCOPED_CLIP::DESTRUCTOR
+// ==========================================================================
+render_surface::scoped_clip::~scoped_clip()
+{
+    surface_.offset_ = previous_offset_;
+    surface_.clip_   = previous_clip_;
+}
+
 // ==========================================================================
 // COLUMN_PROXY::CONSTRUCTOR
 // ==========================================================================
@@ -57,8 +92,9 @@ render_surface::render_surface(terminalpp::canvas &cvs)
 render_surface::render_surface(
     terminalpp::canvas &cvs,
     render_surface_capabilities const &capabilities)
-  : canvas_(cvs),
-    capabilities_(capabilities)
+  : capabilities_(capabilities),
+    canvas_(cvs),
+    clip_{{}, cvs.size()}
 {
 }
 
@@ -87,6 +123,20 @@ terminalpp::extent render_surface::size() const
     return canvas_.size() - offset_;
 }
 
+// ==========================================================================
+// CLIP_REGION
+// ==========================================================================
+terminalpp::rectangle render_surface::clip_region() const
+{
+    return {
+        { 
+            clip_.origin.x - offset_.width, 
+            clip_.origin.y - offset_.height 
+        },
+        clip_.size
+    };
+}
+
 // ==========================================================================
 // OPERATOR[]
 // ==========================================================================
@@ -96,6 +146,82 @@ render_surface::column_proxy render_surface::operator[](
     return column_proxy(*this, column);
 }
 
+// ==========================================================================
+// FILL_ROW
+// ==========================================================================
+void render_surface::fill_row(
+    terminalpp::point const &origin,
+    terminalpp::coordinate_type width,
+    terminalpp::element const &value)
+{
+    auto const row = origin.y + offset_.height;
+
+    if (row < clip_.origin.y || row >= clip_.origin.y + clip_.size.height)
+    {
+        return;
+    }
+
+    auto const first_column = 
+        (std::max)(origin.x + offset_.width, clip_.origin.x);
+    auto const last_column = (std::min)(
+        origin.x + offset_.width + width, 
+        clip_.origin.x + clip_.size.width);
+
+    for (auto column = first_column; column < last_column; ++column)
+    {
+        write_element(column, row, value);
+    }
+}
+
+// ==========================================================================
+// FILL_RECT
+// ==========================================================================
+void render_surface::fill_rect(
+    terminalpp::rectangle const &region,
+    terminalpp::element const &value)
+{
+    for (auto row = region.origin.y; 
+         row < region.origin.y + region.size.height; 
+         ++row)
+    {
+        fill_row({region.origin.x, row}, region.size.width, value);
+    }
+}
+
+// ==========================================================================
+// TRACK_CHANGES
+// ==========================================================================
+void render_surface::track_changes()
+{
+    tracking_changes_ = true;
+    changes_.assign(canvas_.size().height, changed_columns{0, 0});
+}
+
+// ==========================================================================
+// CHANGED_REGIONS
+// ==========================================================================
+std::vector<terminalpp::rectangle> render_surface::changed_regions() const
+{
+    std::vector<terminalpp::rectangle> regions;
+
+    for (auto row = terminalpp::coordinate_type{0}; 
+         row < terminalpp::coordinate_type(changes_.size()); 
+         ++row)
+    {
+        auto const &changed = changes_[row];
+
+        if (changed.begin < changed.end)
+        {
+            regions.push_back({
+                { changed.begin, row }, 
+                { changed.end - changed.begin, 1 }
+            });
+        }
+    }
+
+    return regions;
+}
+
 // ==========================================================================
 // GET_ELEMENT
 // ==========================================================================
@@ -103,7 +229,27 @@ terminalpp::element &render_surface::get_element(
     terminalpp::coordinate_type column, 
     terminalpp::coordinate_type row)
 {
-    return canvas_[column + offset_.width][row + offset_.height];
+    auto const canvas_column = column + offset_.width;
+    auto const canvas_row    = row + offset_.height;
+
+    bool const is_in_clip_region =
+        canvas_column >= clip_.origin.x
+     && canvas_column <  clip_.origin.x + clip_.size.width
+     && canvas_row    >= clip_.origin.y
+     && canvas_row    <  clip_.origin.y + clip_.size.height;
+
+    if (!is_in_clip_region)
+    {
+        discarded_element_ = {};
+        return discarded_element_;
+    }
+
+    if (tracking_changes_)
+    {
+        mark_changed(canvas_column, canvas_row);
+    }
+
+    return canvas_[canvas_column][canvas_row];
 }
 
 }
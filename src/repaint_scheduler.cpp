@@ -0,0 +1,213 @@
+#include "munin/repaint_scheduler.hpp"
+#include "munin/window.hpp"
+#include <boost/make_unique.hpp>
+#include <boost/range/algorithm/remove_if.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace munin {
+
+namespace {
+
+// ==========================================================================
+// SCHEDULED_WINDOW
+// ==========================================================================
+struct scheduled_window
+{
+    std::uint64_t id;
+    window *wnd;
+    std::function<void ()> paint;
+    boost::signals2::scoped_connection repaint_request_connection;
+    
+    bool pending = false;
+    repaint_scheduler::time_point deadline;
+    boost::optional<repaint_scheduler::time_point> last_paint;
+};
+
+}
+
+// ==========================================================================
+// REPAINT_SCHEDULER::IMPLEMENTATION STRUCTURE
+// ==========================================================================
+struct repaint_scheduler::impl
+{
+    // ======================================================================
+    // CONSTRUCTOR
+    // ======================================================================
+    impl(
+        repaint_scheduler &self, 
+        duration frame_interval, 
+        std::function<time_point ()> clock)
+      : self_(self),
+        frame_interval_(frame_interval),
+        clock_(std::move(clock))
+    {
+    }
+
+    // ======================================================================
+    // FIND_WINDOW
+    // ======================================================================
+    // Windows are only ever appended and erased, and each is given a 
+    // greater id than the last, so they are always ordered by id.
+    scheduled_window *find_window(std::uint64_t id)
+    {
+        auto const it = std::lower_bound(
+            windows_.begin(),
+            windows_.end(),
+            id,
+            [](auto const &entry, auto id)
+            {
+                return entry->id < id;
+            });
+
+        return it != windows_.end() && (*it)->id == id
+             ? it->get()
+             : nullptr;
+    }
+
+    // ======================================================================
+    // ON_REPAINT_REQUEST
+    // ======================================================================
+    void on_repaint_request(scheduled_window &entry)
+    {
+        if (entry.pending)
+        {
+            return;
+        }
+
+        auto const now = clock_();
+
+        entry.pending  = true;
+        entry.deadline = entry.last_paint
+                       ? (std::max)(now, *entry.last_paint + frame_interval_)
+                       : now;
+
+        self_.on_repaint_scheduled(entry.deadline);
+    }
+
+    repaint_scheduler &self_;
+    duration frame_interval_;
+    std::function<time_point ()> clock_;
+    std::vector<std::unique_ptr<scheduled_window>> windows_;
+    std::uint64_t next_id_ = 0;
+};
+
+// ==========================================================================
+// CONSTRUCTOR
+// ==========================================================================
+repaint_scheduler::repaint_scheduler(
+    duration frame_interval,
+    std::function<time_point ()> clock)
+  : pimpl_(boost::make_unique<impl>(*this, frame_interval, std::move(clock)))
+{
+}
+
+// ==========================================================================
+// DESTRUCTOR
+// ==========================================================================
+repaint_scheduler::~repaint_scheduler() = default;
+
+// ==========================================================================
+// ADD_WINDOW
+// ==========================================================================
+void repaint_scheduler::add_window(window &wnd, std::function<void ()> paint)
+{
+    auto entry = boost::make_unique<scheduled_window>();
+    entry->id = pimpl_->next_id_++;
+    entry->wnd = &wnd;
+    entry->paint = std::move(paint);
+    
+    auto &current = *entry;
+    entry->repaint_request_connection = wnd.on_repaint_request.connect(
+        [this, &current]
+        {
+            pimpl_->on_repaint_request(current);
+        });
+
+    pimpl_->windows_.push_back(std::move(entry));
+
+    // The window only signals the first request after each repaint, so a
+    // request that it made before it was added would otherwise never be
+    // scheduled.
+    if (wnd.repaint_requested())
+    {
+        pimpl_->on_repaint_request(current);
+    }
+}
+
+// ==========================================================================
+// REMOVE_WINDOW
+// ==========================================================================
+void repaint_scheduler::remove_window(window &wnd)
+{
+    auto &windows = pimpl_->windows_;
+    
+    windows.erase(
+        boost::remove_if(
+            windows,
+            [&wnd](auto const &entry)
+            {
+                return entry->wnd == &wnd;
+            }),
+        windows.end());
+}
+
+// ==========================================================================
+// POLL
+// ==========================================================================
+void repaint_scheduler::poll()
+{
+    auto const now = pimpl_->clock_();
+
+    // The windows that are due are gathered before any are painted so that
+    // a paint function may add or remove windows.  Since it may remove a 
+    // window that is yet to be painted, each one is looked up again just 
+    // before it is painted, and skipped if it has gone.
+    std::vector<std::uint64_t> due_windows;
+
+    for (auto &entry : pimpl_->windows_)
+    {
+        if (entry->pending && entry->deadline <= now)
+        {
+            entry->pending    = false;
+            entry->last_paint = now;
+            due_windows.push_back(entry->id);
+        }
+    }
+
+    for (auto const id : due_windows)
+    {
+        auto const *entry = pimpl_->find_window(id);
+
+        if (entry != nullptr)
+        {
+            // The paint function is copied, since it may remove its own
+            // window, and so destroy the original while it is running.
+            auto const paint = entry->paint;
+            paint();
+        }
+    }
+}
+
+// ==========================================================================
+// NEXT_DEADLINE
+// ==========================================================================
+boost::optional<repaint_scheduler::time_point> 
+    repaint_scheduler::next_deadline() const
+{
+    boost::optional<time_point> result;
+
+    for (auto const &entry : pimpl_->windows_)
+    {
+        if (entry->pending && (!result || entry->deadline < *result))
+        {
+            result = entry->deadline;
+        }
+    }
+
+    return result;
+}
+
+}
@@ -0,0 +1,26 @@
+#include "munin/scrollback.hpp"
+
+namespace munin {
+
+// ==========================================================================
+// DO_GET_CONTENT_EXTENT
+// ==========================================================================
+terminalpp::extent scrollback::do_get_content_extent() const
+{
+    // Once the scrollback has a width, its text flows within it, so the
+    // extent is known from the rows already laid out.  Until then, no
+    // text is flowed and the extent is that of the text itself.
+    return get_size().width > 0
+         ? get_laid_out_extent()
+         : get_preferred_size();
+}
+
+// ==========================================================================
+// MAKE_SCROLLBACK
+// ==========================================================================
+std::shared_ptr<scrollback> make_scrollback()
+{
+    return std::make_shared<scrollback>();
+}
+
+}
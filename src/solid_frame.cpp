@@ -1,6 +1,7 @@
 #include "munin/solid_frame.hpp"
 #include "munin/detail/adaptive_fill.hpp"
 #include "munin/compass_layout.hpp"
+#include "munin/flex_layout.hpp"
 #include "munin/render_surface.hpp"
 #include "munin/view.hpp"
 #include <boost/make_unique.hpp>
@@ -62,16 +63,16 @@ solid_frame::solid_frame()
     auto &attr = pimpl_->current_attribute;
     
     auto north_beam = view(
-        make_compass_layout(),
-        detail::make_top_left_corner_fill(attr), compass_layout::heading::west,
-        detail::make_horizontal_beam_fill(attr), compass_layout::heading::centre,
-        detail::make_top_right_corner_fill(attr),  compass_layout::heading::east);
+        make_flex_layout(flex_direction::row),
+        detail::make_top_left_corner_fill(attr), fixed_track(1),
+        detail::make_horizontal_beam_fill(attr), weighted_track(),
+        detail::make_top_right_corner_fill(attr), fixed_track(1));
     
     auto south_beam = view(
-        make_compass_layout(),
-        detail::make_bottom_left_corner_fill(attr), compass_layout::heading::west,
-        detail::make_horizontal_beam_fill(attr), compass_layout::heading::centre,
-        detail::make_bottom_right_corner_fill(attr), compass_layout::heading::east);
+        make_flex_layout(flex_direction::row),
+        detail::make_bottom_left_corner_fill(attr), fixed_track(1),
+        detail::make_horizontal_beam_fill(attr), weighted_track(),
+        detail::make_bottom_right_corner_fill(attr), fixed_track(1));
         
     auto west_beam = detail::make_vertical_beam_fill(attr);
     auto east_beam = detail::make_vertical_beam_fill(attr);
@@ -1,8 +1,11 @@
 #include "munin/text_area.hpp"
 #include "munin/render_surface.hpp"
-#include <terminalpp/algorithm/for_each_in_region.hpp>
+#include "munin/detail/algorithm.hpp"
+#include <boost/algorithm/clamp.hpp>
 #include <boost/make_unique.hpp>
 #include <boost/range/algorithm/for_each.hpp>
+#include <algorithm>
+#include <iterator>
 
 namespace munin {
 
@@ -22,29 +25,91 @@ struct text_area::impl
     // ======================================================================
     // LAYOUT_TEXT
     // ======================================================================
-    void layout_text()
+    // Lays out the text from the row in which the given index lies to the
+    // end of the document, and returns that row.  The rows before it hold
+    // only text that precedes the index, and so are unaffected.  This keeps
+    // the cost of appending to a long document proportional to the text 
+    // appended, rather than to the whole of the document.
+    terminalpp::coordinate_type layout_text(text_area::text_index from_index)
     {
-        laid_out_text_.clear();
-        laid_out_text_.emplace_back();
+        auto const first_row = std::max(
+            std::distance(
+                row_starts_.begin(),
+                std::upper_bound(
+                    row_starts_.begin(), row_starts_.end(), from_index)) - 1,
+            std::ptrdiff_t{0});
+
+        auto index = row_starts_.empty() 
+                   ? text_area::text_index{0} 
+                   : row_starts_[first_row];
+
+        row_starts_.resize(first_row);
+        row_starts_.push_back(index);
 
         auto const text_area_width = self_.get_size().width;
+        auto const text_size = text_area::text_index(text_.size());
+        auto row_length = terminalpp::coordinate_type{0};
 
-        for(auto const &ch : text_)
+        for (; index < text_size; ++index)
         {
-            if (ch.glyph_.character_ == '\n')
+            if (text_[index].glyph_.character_ == '\n')
             {
-                laid_out_text_.emplace_back();
+                row_starts_.push_back(index + 1);
+                row_length = 0;
             }
             else
             {
-                laid_out_text_.back() += ch;
+                ++row_length;
             }
             
-            if (laid_out_text_.back().size() == text_area_width)
+            if (row_length == text_area_width)
             {
-                laid_out_text_.emplace_back();
+                row_starts_.push_back(index + 1);
+                row_length = 0;
             }
         }
+
+        return terminalpp::coordinate_type(first_row);
+    }
+
+    // ======================================================================
+    // GET_ROW_END
+    // ======================================================================
+    // Rows are not stored separately from the text; a row is just the text
+    // from its start up to the start of the next row, less any newline 
+    // that ended it.
+    text_area::text_index get_row_end(std::size_t row) const
+    {
+        if (row + 1 >= row_starts_.size())
+        {
+            return text_area::text_index(text_.size());
+        }
+
+        auto const row_start = row_starts_[row];
+        auto const next_row_start = row_starts_[row + 1];
+
+        return next_row_start > row_start
+            && text_[next_row_start - 1].glyph_.character_ == '\n'
+             ? next_row_start - 1
+             : next_row_start;
+    }
+
+    // ======================================================================
+    // GET_ROW_LENGTH
+    // ======================================================================
+    terminalpp::coordinate_type get_row_length(std::size_t row) const
+    {
+        return row < row_starts_.size()
+             ? terminalpp::coordinate_type(get_row_end(row) - row_starts_[row])
+             : 0;
+    }
+
+    // ======================================================================
+    // GET_ROW_COUNT
+    // ======================================================================
+    terminalpp::coordinate_type get_row_count() const
+    {
+        return terminalpp::coordinate_type(row_starts_.size());
     }
 
     // ======================================================================
@@ -92,7 +157,9 @@ struct text_area::impl
 
     text_area &self_;
     terminalpp::string text_;
-    std::vector<terminalpp::string> laid_out_text_;
+
+    // The index within the text at which each laid out row begins.
+    std::vector<text_area::text_index> row_starts_;
 
     text_area::text_index caret_position_{0};
     terminalpp::point cursor_position_{0, 0};
@@ -148,10 +215,61 @@ void text_area::insert_text(
         text.begin(),
         text.end());
 
+    // Only the rows from the one in which the text was inserted onwards
+    // can have changed.  Of those, rows beyond both the text area and the
+    // text that was laid out before were blank, and so need only be redrawn
+    // if they now contain text.
+    auto const old_rows = pimpl_->get_row_count();
+    auto const first_row = pimpl_->layout_text(position);
+    auto const last_laid_out_row = pimpl_->get_row_count() - 1;
+    auto const rows = 
+        pimpl_->get_row_length(last_laid_out_row) == 0
+      ? last_laid_out_row
+      : last_laid_out_row + 1;
+    auto const last_row = std::max({get_size().height, old_rows, rows});
+
     on_preferred_size_changed();
-    on_redraw({{{}, get_size()}});
-    
-    pimpl_->layout_text();
+
+    if (last_row > first_row)
+    {
+        on_redraw({{
+            { 0, first_row }, 
+            { get_size().width, last_row - first_row }
+        }});
+    }
+}
+
+// ==========================================================================
+// GET_LAID_OUT_EXTENT
+// ==========================================================================
+terminalpp::extent text_area::get_laid_out_extent() const
+{
+    return { get_size().width, pimpl_->get_row_count() };
+}
+
+// ==========================================================================
+// DO_SET_SIZE
+// ==========================================================================
+void text_area::do_set_size(terminalpp::extent const &size)
+{
+    auto const old_width = get_size().width;
+
+    basic_component::do_set_size(size);
+
+    // Text flows at the width of the text area, and so must be laid out
+    // again if that changes.  The laid out extent changes with it, and so
+    // must be announced for those, such as scrollback, whose preferred 
+    // size depends on it.
+    if (size.width != old_width)
+    {
+        auto const old_laid_out_extent = get_laid_out_extent();
+        pimpl_->layout_text(0);
+
+        if (get_laid_out_extent() != old_laid_out_extent)
+        {
+            on_preferred_size_changed();
+        }
+    }
 }
 
 // ==========================================================================
@@ -206,18 +324,44 @@ void text_area::do_draw(
     render_surface &surface,
     terminalpp::rectangle const &region) const
 {
-    terminalpp::for_each_in_region(
-        surface, 
-        region, 
-        [this](terminalpp::element &elem,
-               terminalpp::coordinate_type column,
-               terminalpp::coordinate_type row)
+    // Only the part of the region that will not be clipped away needs to
+    // be drawn.
+    auto const visible_region = 
+        detail::intersection(region, surface.clip_region());
+
+    if (!visible_region)
+    {
+        return;
+    }
+
+    auto const &text = pimpl_->text_;
+    auto const &row_starts = pimpl_->row_starts_;
+    auto const region_end = 
+        visible_region->origin.x + visible_region->size.width;
+
+    for (auto row = visible_region->origin.y;
+         row < visible_region->origin.y + visible_region->size.height;
+         ++row)
+    {
+        auto const line_width = pimpl_->get_row_length(row);
+
+        // Write whatever text there is in the region on this line, then
+        // blank out the remainder.
+        auto const text_end = boost::algorithm::clamp(
+            line_width, visible_region->origin.x, region_end);
+
+        if (text_end > visible_region->origin.x)
         {
-            elem = (pimpl_->laid_out_text_.size() > row
-                && pimpl_->laid_out_text_[row].size() > column)
-                 ? pimpl_->laid_out_text_[row][column]
-                 : ' ';
-        });
+            auto const row_begin = text.begin() + row_starts[row];
+
+            surface.write_row(
+                { visible_region->origin.x, row },
+                row_begin + visible_region->origin.x,
+                row_begin + text_end);
+        }
+
+        surface.fill_row({ text_end, row }, region_end - text_end, ' ');
+    }
 }
 
 // ==========================================================================
@@ -1,6 +1,7 @@
 #include "munin/titled_frame.hpp"
 #include "munin/detail/adaptive_fill.hpp"
 #include "munin/compass_layout.hpp"
+#include "munin/flex_layout.hpp"
 #include "munin/image.hpp"
 #include "munin/view.hpp"
 #include <boost/make_unique.hpp>
@@ -70,32 +71,30 @@ titled_frame::titled_frame(terminalpp::string const &title)
     
     auto &attr = pimpl_->current_attribute;
     
-    auto title_piece = view(
-        make_compass_layout(),
-        make_fill(' '), compass_layout::heading::west,
-        pimpl_->title, compass_layout::heading::centre,
-        make_fill(' '), compass_layout::heading::east);
-        
+    // The title is given its preferred width, and shrinks before any of
+    // the border does.  Any remaining width is taken up by the beam after
+    // it.  Tracks that still do not fit are truncated from the end of the
+    // row, so the corners are reserved in an outer row first, and it is
+    // the title banner between them that is cut short on narrow frames.
     auto title_banner = view(
-        make_compass_layout(),
-        title_piece, compass_layout::heading::west,
-        detail::make_horizontal_beam_fill(attr), compass_layout::heading::centre);
-        
+        make_flex_layout(flex_direction::row),
+        detail::make_horizontal_beam_fill(attr), fixed_track(1),
+        make_fill(' '), fixed_track(1),
+        pimpl_->title, preferred_track(),
+        make_fill(' '), fixed_track(1),
+        detail::make_horizontal_beam_fill(attr), weighted_track(1, 1));
+
     auto north_beam = view(
-        make_compass_layout(),
-        detail::make_top_left_corner_fill(attr), compass_layout::heading::west,
-        view(
-            make_compass_layout(),
-            detail::make_horizontal_beam_fill(attr), compass_layout::heading::west,
-            title_banner, compass_layout::heading::centre,
-            detail::make_horizontal_beam_fill(attr), compass_layout::heading::east),
-        detail::make_top_right_corner_fill(attr), compass_layout::heading::east);
+        make_flex_layout(flex_direction::row),
+        detail::make_top_left_corner_fill(attr), fixed_track(1),
+        title_banner, weighted_track(),
+        detail::make_top_right_corner_fill(attr), fixed_track(1));
     
     auto south_beam = view(
-        make_compass_layout(),
-        detail::make_bottom_left_corner_fill(attr), compass_layout::heading::west,
-        detail::make_horizontal_beam_fill(attr), compass_layout::heading::centre,
-        detail::make_bottom_right_corner_fill(attr), compass_layout::heading::east);
+        make_flex_layout(flex_direction::row),
+        detail::make_bottom_left_corner_fill(attr), fixed_track(1),
+        detail::make_horizontal_beam_fill(attr), weighted_track(),
+        detail::make_bottom_right_corner_fill(attr), fixed_track(1));
         
     auto west_beam = detail::make_vertical_beam_fill(attr);
     auto east_beam = detail::make_vertical_beam_fill(attr);
@@ -0,0 +1,22 @@
+#include "munin/update_transaction.hpp"
+#include "munin/detail/deferred_notifications.hpp"
+
+namespace munin {
+
+// ==========================================================================
+// CONSTRUCTOR
+// ==========================================================================
+update_transaction::update_transaction()
+{
+    detail::begin_deferring_notifications();
+}
+
+// ==========================================================================
+// DESTRUCTOR
+// ==========================================================================
+update_transaction::~update_transaction()
+{
+    detail::end_deferring_notifications();
+}
+
+}
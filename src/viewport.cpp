@@ -1,10 +1,12 @@
 #include "munin/viewport.hpp"
 #include "munin/render_surface.hpp"
+#include "munin/virtual_content.hpp"
+#include "munin/detail/deferred_notifications.hpp"
 #include <boost/algorithm/clamp.hpp>
 #include <boost/make_unique.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
-#include <boost/scope_exit.hpp>
+#include <cstdlib>
 #include <utility>
 
 namespace munin {
@@ -19,7 +21,9 @@ struct viewport::impl
     // ======================================================================
     impl(viewport& self, std::shared_ptr<component> tracked_component)
       : self_(self),
-        tracked_component_(std::move(tracked_component))
+        tracked_component_(std::move(tracked_component)),
+        virtual_content_(
+            dynamic_cast<virtual_content *>(tracked_component_.get()))
     {
         tracked_component_->on_preferred_size_changed.connect(
             [this]{on_tracked_component_preferred_size_changed();});
@@ -35,13 +39,23 @@ struct viewport::impl
         tracked_component_->on_focus_set.connect(self_.on_focus_set);
         tracked_component_->on_focus_lost.connect(self_.on_focus_lost);
     }
+
+    // ======================================================================
+    // DESTRUCTOR
+    // ======================================================================
+    ~impl()
+    {
+        detail::cancel_deferred_notifications(this);
+    }
     
     // ======================================================================
     // GET_PREFERRED_SIZE
     // ======================================================================
     auto get_preferred_size() const
     {
-        return tracked_component_->get_preferred_size();
+        return virtual_content_ != nullptr
+             ? virtual_content_->get_content_extent()
+             : tracked_component_->get_preferred_size();
     }
 
     // ======================================================================
@@ -118,20 +132,13 @@ struct viewport::impl
         // This means that (2, 2) in the tracked component is (0, 0) in the
         // viewport.  By offsetting by (-2, -2) (the negative of the anchor
         // position), the tracked component draws in the correct space.
-        surface.offset_by({
-            -anchor_position_.x,
-            -anchor_position_.y
-        });
-
-        // Ensure that the offset is unapplied before exit of this
-        // function.
-        BOOST_SCOPE_EXIT_ALL(&surface, this)
-        {
-            surface.offset_by({
-                anchor_position_.x,
-                anchor_position_.y
-            });
-        };
+        // The surface is clipped to the viewport itself before that offset
+        // is applied, so that the component cannot draw outside of the
+        // viewport, whichever way it is scrolled.  The clip restores the
+        // original offset when it goes out of scope.
+        render_surface::scoped_clip const clip(
+            surface, {{}, self_.get_size()});
+        surface.offset_by({-anchor_position_.x, -anchor_position_.y});
 
         tracked_component_->draw(surface, offset_region);
     }
@@ -165,8 +172,17 @@ struct viewport::impl
     // ======================================================================
     void update_tracked_component_size()
     {
-        auto const preferred_size = tracked_component_->get_preferred_size();
         auto const viewport_size = self_.get_size();
+
+        // Virtual content is only ever as large as the part of it that is
+        // seen, however large the content itself may be.
+        if (virtual_content_ != nullptr)
+        {
+            tracked_component_->set_size(viewport_size);
+            return;
+        }
+
+        auto const preferred_size = tracked_component_->get_preferred_size();
         
         auto const tracked_component_size = terminalpp::extent{
             std::max(preferred_size.width, viewport_size.width),
@@ -179,26 +195,19 @@ struct viewport::impl
     // ======================================================================
     // UPDATE_ANCHOR_POSITION
     // ======================================================================
-    void update_anchor_position()
+    void update_anchor_position(bool viewport_resized = false)
     {
         auto const tracked_cursor_position = tracked_component_->get_cursor_position();
         auto const old_anchor_position = anchor_position_;
-        auto const tracked_component_size = tracked_component_->get_size();
+        auto const content_size = get_content_size();
         auto const viewport_size = self_.get_size();
 
-        // Because size changes first match up the size of the tracked
-        // component with the size of the viewport, it must be the case that
-        // the tracked component's size is at least as large as the viewport
-        // itself.
-        assert(tracked_component_size.width >= viewport_size.width);
-        assert(tracked_component_size.height >= viewport_size.height);
-
         // If the viewport has changed its size, look to see if the tracked
         // component is contained entirely in the viewport.  If not, then
         // adjust the anchor appropriately.
         auto const max_allowed_anchor_position = terminalpp::point {
-            tracked_component_size.width - viewport_size.width,
-            tracked_component_size.height - viewport_size.height
+            std::max(content_size.width - viewport_size.width, 0),
+            std::max(content_size.height - viewport_size.height, 0)
         };
 
         anchor_position_ = {
@@ -222,7 +231,11 @@ struct viewport::impl
 
         if (old_anchor_position != anchor_position_)
         {
-            self_.on_redraw({terminalpp::rectangle{{}, self_.get_size()}});
+            if (viewport_resized 
+             || !scroll_viewport(old_anchor_position, viewport_size))
+            {
+                self_.on_redraw({terminalpp::rectangle{{}, viewport_size}});
+            }
         }
     }
 
@@ -246,13 +259,73 @@ struct viewport::impl
     }
 
 private:
+    // ======================================================================
+    // GET_CONTENT_SIZE
+    // ======================================================================
+    terminalpp::extent get_content_size() const
+    {
+        if (virtual_content_ != nullptr)
+        {
+            return virtual_content_->get_content_extent();
+        }
+
+        // Because size changes first match up the size of the tracked
+        // component with the size of the viewport, it must be the case that
+        // the tracked component's size is at least as large as the viewport
+        // itself.
+        auto const tracked_component_size = tracked_component_->get_size();
+        assert(tracked_component_size.width >= self_.get_size().width);
+        assert(tracked_component_size.height >= self_.get_size().height);
+
+        return tracked_component_size;
+    }
+
+    // ======================================================================
+    // SCROLL_VIEWPORT
+    // ======================================================================
+    bool scroll_viewport(
+        terminalpp::point const  &old_anchor_position,
+        terminalpp::extent const &viewport_size)
+    {
+        // If the anchor has moved only vertically, then everything that is
+        // displayed is still correct, but in a different row.  Whatever 
+        // holds what was drawn is offered the chance to move it, so that 
+        // only the rows that are exposed need to be drawn again.
+        auto const rows = anchor_position_.y - old_anchor_position.y;
+
+        if (anchor_position_.x != old_anchor_position.x
+         || std::abs(rows) >= viewport_size.height
+         || !self_.on_scroll({{}, viewport_size}, rows).get_value_or(false))
+        {
+            return false;
+        }
+
+        auto const exposed_rows = std::abs(rows);
+
+        self_.on_redraw({
+            terminalpp::rectangle{
+                { 0, rows > 0 ? viewport_size.height - exposed_rows : 0 },
+                { viewport_size.width, exposed_rows }
+            }});
+
+        return true;
+    }
+
     // ======================================================================
     // ON_TRACKED_COMPONENT_CURSOR_POSITION_CHANGED
     // ======================================================================
     void on_tracked_component_cursor_position_changed()
     {
-        update_anchor_position();
-        update_cursor_position();
+        if (detail::notifications_are_deferred())
+        {
+            deferred_cursor_position_change_ = true;
+            schedule_deferred_notifications();
+        }
+        else
+        {
+            update_anchor_position();
+            update_cursor_position();
+        }
     }
 
     // ======================================================================
@@ -260,15 +333,57 @@ private:
     // ======================================================================
     void on_tracked_component_preferred_size_changed()
     {
-        update_tracked_component_size();
-        self_.on_preferred_size_changed();
+        if (detail::notifications_are_deferred())
+        {
+            deferred_preferred_size_change_ = true;
+            schedule_deferred_notifications();
+        }
+        else
+        {
+            update_tracked_component_size();
+            self_.on_preferred_size_changed();
+        }
+    }
+
+    // ======================================================================
+    // SCHEDULE_DEFERRED_NOTIFICATIONS
+    // ======================================================================
+    void schedule_deferred_notifications()
+    {
+        if (!std::exchange(deferred_notifications_scheduled_, true))
+        {
+            detail::defer_notification(
+                this, [this]{ announce_deferred_notifications(); });
+        }
+    }
+
+    // ======================================================================
+    // ANNOUNCE_DEFERRED_NOTIFICATIONS
+    // ======================================================================
+    void announce_deferred_notifications()
+    {
+        deferred_notifications_scheduled_ = false;
+
+        // The size of the tracked component must be settled before the 
+        // anchor can be moved to follow its cursor.
+        if (std::exchange(deferred_preferred_size_change_, false))
+        {
+            update_tracked_component_size();
+            self_.on_preferred_size_changed();
+        }
+
+        if (std::exchange(deferred_cursor_position_change_, false))
+        {
+            update_anchor_position();
+            update_cursor_position();
+        }
     }
     
     // ======================================================================
     // ON_TRACKED_COMPONENT_REDRAW
     // ======================================================================
     void on_tracked_component_redraw(
-        std::vector<terminalpp::rectangle> const &regions)
+        rectangle_list const &regions)
     {
         auto const viewport_size = self_.get_size();
 
@@ -311,7 +426,7 @@ private:
         using boost::adaptors::transformed;
 
         self_.on_redraw(
-            boost::copy_range<std::vector<terminalpp::rectangle>>(
+            boost::copy_range<rectangle_list>(
                 regions | transformed(translate_region)
                         | transformed(clip_region)
                         | filtered(region_is_in_viewable_area)
@@ -320,8 +435,13 @@ private:
 
     viewport &self_;
     std::shared_ptr<component> tracked_component_;
+    virtual_content           *virtual_content_;
     terminalpp::point          anchor_position_;
     terminalpp::point          cursor_position_;
+
+    bool deferred_preferred_size_change_ = false;
+    bool deferred_cursor_position_change_ = false;
+    bool deferred_notifications_scheduled_ = false;
 };
 
 // ==========================================================================
@@ -342,9 +462,14 @@ viewport::~viewport() = default;
 // ==========================================================================
 void viewport::do_set_size(terminalpp::extent const &size)
 {
+    if (size == get_size())
+    {
+        return;
+    }
+
     basic_component::do_set_size(size);
     pimpl_->update_tracked_component_size();
-    pimpl_->update_anchor_position();
+    pimpl_->update_anchor_position(true);
     pimpl_->update_cursor_position();
 }
 
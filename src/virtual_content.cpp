@@ -0,0 +1,13 @@
+#include "munin/virtual_content.hpp"
+
+namespace munin {
+
+// ==========================================================================
+// GET_CONTENT_EXTENT
+// ==========================================================================
+terminalpp::extent virtual_content::get_content_extent() const
+{
+    return do_get_content_extent();
+}
+
+}
@@ -1,13 +1,37 @@
 #include "munin/window.hpp"
 #include "munin/component.hpp"
 #include "munin/render_surface.hpp"
+#include "munin/detail/algorithm.hpp"
 #include "munin/detail/json_adaptors.hpp"
+#include "munin/detail/region.hpp"
+#include <terminalpp/ansi/control_characters.hpp>
+#include <terminalpp/ansi/csi.hpp>
 #include <terminalpp/screen.hpp>
 #include <terminalpp/terminal.hpp>
 #include <boost/make_unique.hpp>
+#include <boost/optional.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <utility>
 
 namespace munin {
 
+namespace {
+
+// The final character of DECSTBM, which sets the scrolling region.
+constexpr char const set_top_and_bottom_margins = 'r';
+
+// ==========================================================================
+// CONTROL_SEQUENCE
+// ==========================================================================
+std::string control_sequence(std::string const &parameters, char command)
+{
+    return terminalpp::ansi::control7::CSI + parameters + command;
+}
+
+}
+
 // ==========================================================================
 // WINDOW IMPLEMENTATION STRUCTURE
 // ==========================================================================
@@ -24,27 +48,223 @@ struct window::impl
     // ======================================================================
     // REQUEST_REPAINT
     // ======================================================================
-    void request_repaint(std::vector<terminalpp::rectangle> const &regions)
+    void request_repaint(rectangle_list const &regions)
     {
-        bool first_request = repaint_regions_.empty();
-        
-        repaint_regions_.insert(
-            repaint_regions_.end(), 
-            regions.begin(),
-            regions.end());
+        // Regions are merged as they arrive so that overlapping requests
+        // (e.g. a frame highlight and a keystroke in the framed component)
+        // do not cause the same cells to be drawn more than once.
+        ++statistics_.repaint_requests;
 
-        if (first_request)
+        for (auto const &region : regions)
+        {
+            repaint_region_.add(region);
+        }
+
+        if (!std::exchange(repaint_requested_, true))
         {
             self_.on_repaint_request();
         }
     }
+
+    // ======================================================================
+    // REQUEST_SCROLL
+    // ======================================================================
+    bool request_scroll(
+        terminalpp::rectangle const &region, 
+        terminalpp::coordinate_type  rows)
+    {
+        // Only one region can be waiting to be scrolled.  If another is
+        // scrolled in the meantime, then the first is painted instead.
+        if (scroll_ && scroll_->region != region)
+        {
+            repaint_region_.add(scroll_->region);
+            scroll_ = boost::none;
+        }
+
+        // Anything already waiting to be painted within the region has 
+        // moved with it.
+        repaint_region_.scroll(region, rows);
+
+        // Terminals can only scroll whole rows, so a region that does not
+        // span the width of the window is painted instead.
+        auto const content_size = content_->get_size();
+        auto const total_rows = (scroll_ ? scroll_->rows : 0) + rows;
+
+        if (region.origin.x == 0
+         && region.size.width == content_size.width
+         && region.origin.y >= 0
+         && region.origin.y + region.size.height <= content_size.height
+         && std::abs(total_rows) < region.size.height)
+        {
+            scroll_ = pending_scroll{region, total_rows};
+            request_repaint({});
+        }
+        else
+        {
+            scroll_ = boost::none;
+            request_repaint({region});
+        }
+
+        return true;
+    }
+
+    // ======================================================================
+    // APPLY_SCROLL
+    // ======================================================================
+    terminalpp::rectangle apply_scroll(
+        terminalpp::terminal &term,
+        terminalpp::canvas &cvs,
+        std::string &result)
+    {
+        auto const region = scroll_->region;
+        auto const rows   = scroll_->rows;
+        scroll_ = boost::none;
+
+        if (rows == 0)
+        {
+            return {};
+        }
+
+        // Both the canvas and the last frame are moved in the same way as
+        // the terminal, so that they continue to match it.
+        detail::scroll_canvas(cvs, region, rows);
+        detail::scroll_canvas(*last_frame_, region, rows);
+
+        // The terminal is scrolled by restricting its scrolling region
+        // (DECSTBM) to the rows in question and scrolling that up (SU) or
+        // down (SD).  Resetting the scrolling region afterwards homes the
+        // cursor, and so the terminal must be told where it is.
+        auto const top    = region.origin.y + 1;
+        auto const bottom = region.origin.y + region.size.height;
+
+        result += control_sequence(
+            std::to_string(top) + terminalpp::ansi::PS + std::to_string(bottom),
+            set_top_and_bottom_margins);
+        result += control_sequence(
+            std::to_string(std::abs(rows)),
+            rows > 0 
+          ? terminalpp::ansi::csi::SCROLL_UP 
+          : terminalpp::ansi::csi::SCROLL_DOWN);
+        result += control_sequence({}, set_top_and_bottom_margins);
+        result += term.move_cursor({0, 0});
+
+        ++statistics_.scrolls;
+
+        auto const exposed_rows = std::abs(rows);
+
+        return {
+            { 0, rows > 0 ? bottom - exposed_rows : region.origin.y },
+            { region.size.width, exposed_rows }
+        };
+    }
+
+    // ======================================================================
+    // DRAW_EXPOSED
+    // ======================================================================
+    void draw_exposed(
+        terminalpp::terminal &term,
+        terminalpp::canvas const &cvs,
+        terminalpp::rectangle const &exposed,
+        std::string &result)
+    {
+        // Terminals differ in how they fill the rows exposed by a scroll,
+        // so these are written out in full rather than compared against 
+        // the last frame.
+        auto &last_frame = *last_frame_;
+
+        for (auto row = exposed.origin.y; 
+             row < exposed.origin.y + exposed.size.height; 
+             ++row)
+        {
+            auto &line = draw_buffer_;
+            line.erase(line.begin(), line.end());
+
+            for (auto column = exposed.origin.x;
+                 column < exposed.origin.x + exposed.size.width;
+                 ++column)
+            {
+                line += cvs[column][row];
+                last_frame[column][row] = cvs[column][row];
+            }
+
+            result += term.move_cursor({exposed.origin.x, row});
+            result += term.write(line);
+        }
+    }
     
+    // ======================================================================
+    // DRAW_DAMAGE
+    // ======================================================================
+    void draw_damage(
+        terminalpp::terminal &term,
+        terminalpp::canvas const &cvs,
+        detail::region const &damage,
+        std::string &result)
+    {
+        auto &last_frame = *last_frame_;
+
+        for (auto const &rect : damage.rectangles())
+        {
+            auto const right  = rect.origin.x + rect.size.width;
+            auto const bottom = rect.origin.y + rect.size.height;
+
+            for (auto row = rect.origin.y; row < bottom; ++row)
+            {
+                auto column = rect.origin.x;
+
+                while (column < right)
+                {
+                    if (cvs[column][row] == last_frame[column][row])
+                    {
+                        ++column;
+                        continue;
+                    }
+
+                    // Gather the run of changed cells so that it can be
+                    // written with a single cursor movement.
+                    auto const run_start = column;
+                    auto &run = draw_buffer_;
+                    run.erase(run.begin(), run.end());
+
+                    while (column < right
+                        && cvs[column][row] != last_frame[column][row])
+                    {
+                        run += cvs[column][row];
+                        last_frame[column][row] = cvs[column][row];
+                        ++column;
+                    }
+
+                    result += term.move_cursor({run_start, row});
+                    result += term.write(run);
+                }
+            }
+        }
+    }
+
+    struct pending_scroll
+    {
+        terminalpp::rectangle       region;
+        terminalpp::coordinate_type rows;
+    };
+
     window &self_;
     std::shared_ptr<component> content_;
 
-    std::vector<terminalpp::rectangle> repaint_regions_;
+    detail::region repaint_region_;
+    boost::optional<pending_scroll> scroll_;
+    bool repaint_requested_ = false;
 
+    // The screen is used only for full redraws.  Otherwise, the last frame
+    // is compared against the canvas only within the damaged region.
     terminalpp::screen screen_;
+    boost::optional<terminalpp::canvas> last_frame_;
+
+    // Each run of cells written to the terminal is gathered here.  It is
+    // emptied rather than replaced between runs, so that it keeps its 
+    // capacity and painting does not allocate for every run.
+    terminalpp::string draw_buffer_;
+
+    window_statistics statistics_;
 };
 
 // ==========================================================================
@@ -60,6 +280,12 @@ window::window(std::shared_ptr<component> content)
         {
             pimpl_->request_repaint(regions);
         });
+
+    pimpl_->content_->on_scroll.connect(
+        [this](auto const &region, auto rows)
+        {
+            return pimpl_->request_scroll(region, rows);
+        });
 }
 
 // ==========================================================================
@@ -82,29 +308,125 @@ void window::event(boost::any const &ev)
 // ==========================================================================
 std::string window::repaint(
     terminalpp::canvas &cvs, terminalpp::terminal &term)
+{
+    std::string paint_data;
+    repaint(cvs, term, paint_data);
+    return paint_data;
+}
+
+// ==========================================================================
+// REPAINT
+// ==========================================================================
+void window::repaint(
+    terminalpp::canvas &cvs, 
+    terminalpp::terminal &term, 
+    std::string &paint_data)
 {
     auto const canvas_size = cvs.size();
     
-    std::vector<terminalpp::rectangle> repaint_regions;
+    detail::region repaint_region;
     
     if (cvs.size() != pimpl_->content_->get_size())
     {
         pimpl_->content_->set_size(cvs.size());
-        repaint_regions.clear();
-        repaint_regions.push_back({{}, canvas_size});
+        pimpl_->repaint_region_.clear();
+        pimpl_->scroll_ = boost::none;
+        repaint_region.add({{}, canvas_size});
     }
     else
     {
-        repaint_regions.swap(pimpl_->repaint_regions_);
+        // A scroll can only be applied on top of a frame that has already
+        // been painted.  Otherwise, the region is simply painted.
+        auto const &last_frame = pimpl_->last_frame_;
+
+        if (pimpl_->scroll_ 
+         && (!last_frame || last_frame->size() != canvas_size))
+        {
+            pimpl_->repaint_region_.add(pimpl_->scroll_->region);
+            pimpl_->scroll_ = boost::none;
+        }
+
+        std::swap(repaint_region, pimpl_->repaint_region_);
     }
 
+    pimpl_->repaint_requested_ = false;
+
+    auto &statistics = pimpl_->statistics_;
+    auto const initial_paint_data_size = paint_data.size();
+
+    // The terminal is scrolled before anything is drawn, so that the rows
+    // that it exposes can then be painted into place.
+    auto const exposed_region = pimpl_->scroll_
+        ? pimpl_->apply_scroll(term, cvs, paint_data)
+        : terminalpp::rectangle{};
+
+    auto const draw_start = std::chrono::steady_clock::now();
+    
     render_surface surface(cvs);
-    for (auto const &region : repaint_regions)
+    surface.track_changes();
+    
+    for (auto const &region : repaint_region.rectangles())
     {
         pimpl_->content_->draw(surface, region);
+
+        auto const area = region.size.width * region.size.height;
+        auto const &largest = statistics.largest_region;
+        
+        if (area > largest.width * largest.height)
+        {
+            statistics.largest_region = region.size;
+        }
+
+        ++statistics.merged_regions;
+        statistics.cells_drawn += area;
     }
 
-    return pimpl_->screen_.draw(term, cvs);
+    auto const diff_start = std::chrono::steady_clock::now();
+
+    if (!pimpl_->last_frame_ || pimpl_->last_frame_->size() != canvas_size)
+    {
+        pimpl_->last_frame_ = cvs;
+        paint_data += pimpl_->screen_.draw(term, cvs);
+    }
+    else
+    {
+        // Only those parts of the canvas that were actually changed by the
+        // draw need to be compared against the last frame.
+        detail::region changed_region;
+
+        for (auto const &changed : surface.changed_regions())
+        {
+            changed_region.add(changed);
+        }
+
+        changed_region.subtract(exposed_region);
+
+        pimpl_->draw_exposed(term, cvs, exposed_region, paint_data);
+        pimpl_->draw_damage(term, cvs, changed_region, paint_data);
+    }
+
+    auto const diff_end = std::chrono::steady_clock::now();
+
+    ++statistics.repaints;
+    statistics.bytes_emitted += paint_data.size() - initial_paint_data_size;
+    statistics.draw_time += diff_start - draw_start;
+    statistics.diff_time += diff_end - diff_start;
+}
+
+// ==========================================================================
+// GET_STATISTICS
+// ==========================================================================
+window_statistics const &window::get_statistics() const
+{
+    return pimpl_->statistics_;
+}
+
+// ==========================================================================
+// REPAINT_REQUESTED
+// ==========================================================================
+bool window::repaint_requested() const
+{
+    return pimpl_->repaint_requested_;
 }
 
 // ==========================================================================
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <munin/layout_hint.hpp>
+#include <ostream>
+
+namespace munin {
+
+//* =========================================================================
+/// \brief Prints a layout hint for the benefit of GoogleTest, which would
+/// otherwise try to use the variant's stream operator.  That requires
+/// every alternative to be streamable, which they are not.
+//* =========================================================================
+inline void PrintTo(layout_hint const &hint, std::ostream *out)
+{
+    if (auto const *heading = boost::get<compass_heading>(&hint))
+    {
+        *out << "compass_heading(" << static_cast<int>(*heading) << ")";
+    }
+    else if (auto const *align = boost::get<alignment>(&hint))
+    {
+        *out << "alignment("
+             << static_cast<int>(align->horizontal) << ", "
+             << static_cast<int>(align->vertical) << ")";
+    }
+    else if (auto const *track = boost::get<flex_track>(&hint))
+    {
+        *out << "flex_track("
+             << static_cast<int>(track->basis) << ", "
+             << track->value << ", "
+             << track->minimum << ", "
+             << track->maximum << ")";
+    }
+    else if (boost::get<boost::any>(&hint) != nullptr)
+    {
+        *out << "layout_hint(any)";
+    }
+    else
+    {
+        *out << "layout_hint()";
+    }
+}
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <munin/layout.hpp>
+#include "layout_hint_printer.hpp"
 #include <gmock/gmock.h>
 
 //* =========================================================================
@@ -19,7 +20,7 @@ public :
         do_get_preferred_size,
         terminalpp::extent (
             std::vector<std::shared_ptr<munin::component>> const &components,
-            std::vector<boost::any>                        const &hints));
+            std::vector<munin::layout_hint>                 const &hints));
 
     //* =====================================================================
     /// \brief Called by operator().  Derived classes must override this
@@ -30,7 +31,7 @@ public :
         do_layout,
         void (
             std::vector<std::shared_ptr<munin::component>> const &components,
-            std::vector<boost::any>                        const &hints,
+            std::vector<munin::layout_hint>                 const &hints,
             terminalpp::extent                                    size));
 
     //* =====================================================================
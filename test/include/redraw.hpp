@@ -1,8 +1,13 @@
 #pragma once
 
+#include <munin/rectangle_list.hpp>
 #include <terminalpp/rectangle.hpp>
 #include <vector>
 
 void assert_equivalent_redraw_regions(
     std::vector<terminalpp::rectangle> const &lhs,
-    std::vector<terminalpp::rectangle> const &rhs);
\ No newline at end of file
+    std::vector<terminalpp::rectangle> const &rhs);
+
+void assert_equivalent_redraw_regions(
+    std::vector<terminalpp::rectangle> const &lhs,
+    munin::rectangle_list const &rhs);
\ No newline at end of file
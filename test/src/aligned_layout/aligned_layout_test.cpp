@@ -30,7 +30,7 @@ TEST(aligned_layout_test, preferred_size_is_maximum_with_and_height_of_component
     
     auto const preferred_size = lyt->get_preferred_size(
         std::vector<std::shared_ptr<munin::component>>{ component0, component1 },
-        std::vector<boost::any>{ munin::alignment_hcvb, munin::alignment_hcvt });
+        std::vector<munin::layout_hint>{ munin::alignment_hcvb, munin::alignment_hcvt });
         
     auto const expected_size = terminalpp::extent{10, 12};
     
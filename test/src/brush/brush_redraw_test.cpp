@@ -12,7 +12,7 @@ TEST(a_brush_to_be_redrawn, redraws_entire_brush_when_setting_pattern)
         [&redraw_called, &redraw_regions](auto const &regions)
     {
         ++redraw_called;
-        redraw_regions = regions;
+        redraw_regions.assign(regions.begin(), regions.end());
     });
 
     brush.set_pattern("test");
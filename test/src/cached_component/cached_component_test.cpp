@@ -0,0 +1,125 @@
+#include "mock/component.hpp"
+#include "redraw.hpp"
+#include <munin/cached_component.hpp>
+#include <terminalpp/canvas.hpp>
+#include <gtest/gtest.h>
+
+using testing::Invoke;
+using testing::Return;
+using testing::_;
+
+namespace {
+
+class a_cached_component : public testing::Test
+{
+protected :
+    void SetUp() override
+    {
+        ON_CALL(*content_, do_draw(_, _))
+            .WillByDefault(Invoke(
+                [this](munin::render_surface &surface, 
+                       terminalpp::rectangle const &region)
+                {
+                    ++draw_count_;
+                    drawn_regions_.push_back(region);
+                    surface.fill_rect(region, fill_);
+                }));
+
+        cached_->set_size({4, 3});
+    }
+
+    void draw(terminalpp::rectangle const &region)
+    {
+        munin::render_surface surface{canvas_};
+        cached_->draw(surface, region);
+    }
+
+    std::shared_ptr<mock_component> content_ = make_mock_component();
+    std::shared_ptr<munin::cached_component> cached_ =
+        munin::make_cached_component(content_);
+
+    terminalpp::canvas canvas_{{4, 3}};
+    terminalpp::element fill_ = 'a';
+    int draw_count_ = 0;
+    std::vector<terminalpp::rectangle> drawn_regions_;
+};
+
+}
+
+TEST_F(a_cached_component, draws_its_content_on_the_first_draw)
+{
+    draw({{}, {4, 3}});
+
+    ASSERT_EQ(1, draw_count_);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[0][0]);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[3][2]);
+}
+
+TEST_F(a_cached_component, copies_from_its_cache_on_later_draws)
+{
+    draw({{}, {4, 3}});
+
+    fill_ = 'b';
+    canvas_ = terminalpp::canvas{{4, 3}};
+    draw({{1, 1}, {2, 1}});
+
+    ASSERT_EQ(1, draw_count_);
+    ASSERT_EQ(terminalpp::element(' '), canvas_[0][1]);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[1][1]);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[2][1]);
+    ASSERT_EQ(terminalpp::element(' '), canvas_[3][1]);
+}
+
+TEST_F(a_cached_component, redraws_only_regions_its_content_announces)
+{
+    int redraw_count = 0;
+    cached_->on_redraw.connect(
+        [&redraw_count](auto const &regions)
+        {
+            ++redraw_count;
+            assert_equivalent_redraw_regions({{{1, 0}, {1, 2}}}, regions);
+        });
+
+    draw({{}, {4, 3}});
+    fill_ = 'b';
+    drawn_regions_.clear();
+
+    content_->on_redraw({{{1, 0}, {1, 2}}});
+    ASSERT_EQ(1, redraw_count);
+
+    draw({{}, {4, 3}});
+
+    ASSERT_EQ(2, draw_count_);
+    assert_equivalent_redraw_regions({{{1, 0}, {1, 2}}}, drawn_regions_);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[0][0]);
+    ASSERT_EQ(terminalpp::element('b'), canvas_[1][0]);
+    ASSERT_EQ(terminalpp::element('b'), canvas_[1][1]);
+    ASSERT_EQ(terminalpp::element('a'), canvas_[1][2]);
+}
+
+TEST_F(a_cached_component, redraws_everything_after_a_change_of_size)
+{
+    draw({{}, {4, 3}});
+
+    EXPECT_CALL(*content_, do_set_size(terminalpp::extent{3, 3}));
+    cached_->set_size({3, 3});
+
+    draw({{}, {1, 1}});
+
+    ASSERT_EQ(2, draw_count_);
+    ASSERT_EQ(terminalpp::rectangle({}, {3, 3}), drawn_regions_.back());
+}
+
+TEST_F(a_cached_component, forwards_events_to_its_content)
+{
+    EXPECT_CALL(*content_, do_event(_));
+    cached_->event(boost::any{});
+}
+
+TEST_F(a_cached_component, reports_the_preferred_size_of_its_content)
+{
+    ON_CALL(*content_, do_get_preferred_size())
+        .WillByDefault(Return(terminalpp::extent{7, 2}));
+
+    ASSERT_EQ(terminalpp::extent(7, 2), cached_->get_preferred_size());
+}
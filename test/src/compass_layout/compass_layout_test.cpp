@@ -1,3 +1,4 @@
+#include "layout_hint_printer.hpp"
 #include "mock/component.hpp"
 #include <munin/compass_layout.hpp>
 #include <terminalpp/rectangle.hpp>
@@ -6,11 +7,11 @@
 using testing::Return;
 using testing::ValuesIn;
 
-const static auto north  = boost::any{munin::compass_layout::heading::north};
-const static auto south  = boost::any{munin::compass_layout::heading::south};
-const static auto east   = boost::any{munin::compass_layout::heading::east};
-const static auto west   = boost::any{munin::compass_layout::heading::west};
-const static auto centre = boost::any{munin::compass_layout::heading::centre};
+const static auto north  = munin::layout_hint{munin::compass_layout::heading::north};
+const static auto south  = munin::layout_hint{munin::compass_layout::heading::south};
+const static auto east   = munin::layout_hint{munin::compass_layout::heading::east};
+const static auto west   = munin::layout_hint{munin::compass_layout::heading::west};
+const static auto centre = munin::layout_hint{munin::compass_layout::heading::centre};
 
 TEST(compass_layout_test, reports_attributes_as_json)
 {
@@ -30,7 +31,7 @@ TEST(a_compass_layout_with_no_elements, has_a_zero_preferred_size)
 
 using compass_layout_component_data = std::tuple<
     terminalpp::extent,   // preferred size
-    boost::any,           // layout hint
+    munin::layout_hint,   // layout hint
     terminalpp::rectangle // expected size
 >;
 
@@ -54,7 +55,7 @@ TEST_P(compass_layouts, place_components_at_these_positions)
     auto const &expected_preferred_size = std::get<2>(param);
 
     std::vector<std::shared_ptr<munin::component>> components;
-    std::vector<boost::any> hints;
+    std::vector<munin::layout_hint> hints;
 
     for (auto const &component_datum : component_data)
     {
@@ -86,7 +87,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 0 }, { 10, 10 } }
             }},
             { 10, 10 },
@@ -96,7 +97,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 10, 5 } }
             }},
             { 10, 10 },
@@ -106,7 +107,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 5 }, { 10, 5 } }
             }},
             { 10, 10 },
@@ -116,7 +117,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 5, 10 } }
             }},
             { 10, 10 },
@@ -126,7 +127,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 5, 0 }, { 5, 10 } }
             }},
             { 10, 10 },
@@ -143,12 +144,12 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 10, 5 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 5 }, { 10, 5 } }
             }},
             { 10, 10 },
@@ -158,12 +159,12 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 5 }, { 10, 5 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 0 }, { 10, 5 } }
             }},
             { 10, 10 },
@@ -173,12 +174,12 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 5, 10 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 5, 0 }, { 5, 10 } }
             }},
             { 10, 10 },
@@ -188,12 +189,12 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 5, 0 }, { 5, 10 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 0 }, { 5, 10 } }
             }},
             { 10, 10 },
@@ -210,7 +211,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 0 }, { 2, 2 } }
             }},
             { 2, 2 },
@@ -220,7 +221,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 2, 2 } }
             }},
             { 2, 2 },
@@ -230,7 +231,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 0 }, { 2, 2 } }
             }},
             { 2, 2 },
@@ -240,7 +241,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 2, 2 } }
             }},
             { 2, 2 },
@@ -250,7 +251,7 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 0, 0 }, { 2, 2 } }
             }},
             { 2, 2 },
@@ -284,27 +285,27 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 12, 3 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 9 }, { 12, 3 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 9, 3 }, { 3, 6 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 3 }, { 3, 6 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 3, 3 }, { 6, 6 } }
             }},
             { 12, 12 },
@@ -330,27 +331,27 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 3, 12 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 9, 0 }, { 3, 12 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 3, 0 }, { 6, 3 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 3, 9 }, { 6, 3 } }
             },
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 3, 3 }, { 6, 6 } }
             }},
             { 12, 12 },
@@ -376,27 +377,27 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 12, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 0, 0 }, { 0, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 12, 0 }, { 0, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 12, 0 }, { 0, 0 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 12, 12 }, { 0, 0 } }
             }},
             { 12, 12 },
@@ -422,27 +423,27 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 0, 0 }, { 12, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 0 }, { 0, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 0, 12 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 0 }, { 0, 0 } }
             },
             compass_layout_component_data {
                 { 12, 12 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 0, 12 }, { 0, 0 } }
             }},
             { 12, 12 },
@@ -459,27 +460,27 @@ INSTANTIATE_TEST_SUITE_P(
         compass_layout_test_data {{
             compass_layout_component_data {
                 { 5, 5 },
-                boost::any(munin::compass_layout::heading::centre),
+                munin::layout_hint(munin::compass_layout::heading::centre),
                 { { 3, 3 }, { 6, 6 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::north),
+                munin::layout_hint(munin::compass_layout::heading::north),
                 { { 0, 0 }, { 12, 3 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::south),
+                munin::layout_hint(munin::compass_layout::heading::south),
                 { { 0, 9 }, { 12, 3 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::east),
+                munin::layout_hint(munin::compass_layout::heading::east),
                 { { 9, 3 }, { 3, 6 } }
             },
             compass_layout_component_data {
                 { 3, 3 },
-                boost::any(munin::compass_layout::heading::west),
+                munin::layout_hint(munin::compass_layout::heading::west),
                 { { 0, 3 }, { 3, 6 } }
             }},
             { 12, 12 },
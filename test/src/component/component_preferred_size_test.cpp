@@ -0,0 +1,53 @@
+#include "mock/component.hpp"
+#include <gtest/gtest.h>
+
+using testing::Return;
+
+TEST(a_component, remembers_its_preferred_size)
+{
+    mock_component component;
+
+    EXPECT_CALL(component, do_get_preferred_size())
+        .WillOnce(Return(terminalpp::extent{3, 4}));
+
+    ASSERT_EQ(terminalpp::extent(3, 4), component.get_preferred_size());
+    ASSERT_EQ(terminalpp::extent(3, 4), component.get_preferred_size());
+}
+
+TEST(a_component, recalculates_its_preferred_size_after_it_changes)
+{
+    mock_component component;
+
+    EXPECT_CALL(component, do_get_preferred_size())
+        .WillOnce(Return(terminalpp::extent{3, 4}))
+        .WillOnce(Return(terminalpp::extent{5, 6}));
+
+    ASSERT_EQ(terminalpp::extent(3, 4), component.get_preferred_size());
+
+    component.on_preferred_size_changed();
+
+    ASSERT_EQ(terminalpp::extent(5, 6), component.get_preferred_size());
+    ASSERT_EQ(terminalpp::extent(5, 6), component.get_preferred_size());
+}
+
+TEST(a_component, reports_its_new_preferred_size_to_observers_of_its_change)
+{
+    mock_component component;
+
+    EXPECT_CALL(component, do_get_preferred_size())
+        .WillOnce(Return(terminalpp::extent{3, 4}))
+        .WillOnce(Return(terminalpp::extent{5, 6}));
+
+    component.get_preferred_size();
+
+    terminalpp::extent observed_preferred_size;
+    component.on_preferred_size_changed.connect(
+        [&]
+        {
+            observed_preferred_size = component.get_preferred_size();
+        });
+
+    component.on_preferred_size_changed();
+
+    ASSERT_EQ(terminalpp::extent(5, 6), observed_preferred_size);
+}
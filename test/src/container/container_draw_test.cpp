@@ -128,3 +128,151 @@ TEST_F(a_container, draws_many_components_when_drawing)
 
     container.draw(surface, terminalpp::rectangle({1, 1}, {2, 2}));
 }
+
+TEST_F(a_container, clips_subcomponents_to_their_bounds)
+{
+    using testing::Invoke;
+
+    auto component = std::make_shared<mock_component>();
+
+    container.set_size({3, 1});
+
+    container.add_component(component);
+
+    terminalpp::canvas canvas({3, 1});
+    munin::render_surface surface{canvas};
+
+    ON_CALL(*component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(1, 0)));
+    ON_CALL(*component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(1, 1)));
+
+    EXPECT_CALL(*component, do_draw(_, _))
+        .WillOnce(Invoke(
+            [](munin::render_surface &surface, auto const &)
+            {
+                ASSERT_EQ(
+                    terminalpp::rectangle({0, 0}, {1, 1}), 
+                    surface.clip_region());
+
+                surface[-1][0] = 'x';
+                surface[0][0]  = 'y';
+                surface[1][0]  = 'z';
+            }));
+
+    container.draw(surface, terminalpp::rectangle({0, 0}, {3, 1}));
+
+    ASSERT_EQ(terminalpp::element(' '), canvas[0][0]);
+    ASSERT_EQ(terminalpp::element('y'), canvas[1][0]);
+    ASSERT_EQ(terminalpp::element(' '), canvas[2][0]);
+}
+
+namespace {
+
+class opaque_mock_component : public mock_component
+{
+protected :
+    bool do_is_opaque() const override
+    {
+        return true;
+    }
+};
+
+}
+
+TEST_F(a_container, does_not_draw_subcomponents_hidden_by_later_opaque_subcomponents)
+{
+    auto hidden_component = std::make_shared<mock_component>();
+    auto opaque_component = std::make_shared<opaque_mock_component>();
+
+    container.set_size({2, 2});
+    container.add_component(hidden_component);
+    container.add_component(opaque_component);
+
+    terminalpp::canvas canvas({2, 2});
+    munin::render_surface surface{canvas};
+
+    ON_CALL(*hidden_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*hidden_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+    ON_CALL(*opaque_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*opaque_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+
+    EXPECT_CALL(*hidden_component, do_draw(_, _)).Times(0);
+    EXPECT_CALL(
+        *opaque_component, 
+        do_draw(_, terminalpp::rectangle({0, 0}, {2, 2})));
+
+    container.draw(surface, terminalpp::rectangle({0, 0}, {2, 2}));
+}
+
+TEST_F(a_container, draws_only_the_parts_of_subcomponents_not_hidden_by_later_opaque_subcomponents)
+{
+    auto partially_hidden_component = std::make_shared<mock_component>();
+    auto opaque_component = std::make_shared<opaque_mock_component>();
+
+    container.set_size({2, 2});
+    container.add_component(partially_hidden_component);
+    container.add_component(opaque_component);
+
+    terminalpp::canvas canvas({2, 2});
+    munin::render_surface surface{canvas};
+
+    ON_CALL(*partially_hidden_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*partially_hidden_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+    ON_CALL(*opaque_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(1, 0)));
+    ON_CALL(*opaque_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(1, 2)));
+
+    {
+        testing::InSequence s1;
+        EXPECT_CALL(
+            *partially_hidden_component, 
+            do_draw(_, terminalpp::rectangle({0, 0}, {1, 2})));
+        EXPECT_CALL(
+            *opaque_component, 
+            do_draw(_, terminalpp::rectangle({0, 0}, {1, 2})));
+    }
+
+    container.draw(surface, terminalpp::rectangle({0, 0}, {2, 2}));
+}
+
+TEST_F(a_container, draws_subcomponents_hidden_only_by_earlier_opaque_subcomponents)
+{
+    auto opaque_component = std::make_shared<opaque_mock_component>();
+    auto later_component = std::make_shared<mock_component>();
+
+    container.set_size({2, 2});
+    container.add_component(opaque_component);
+    container.add_component(later_component);
+
+    terminalpp::canvas canvas({2, 2});
+    munin::render_surface surface{canvas};
+
+    ON_CALL(*opaque_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*opaque_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+    ON_CALL(*later_component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*later_component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+
+    {
+        testing::InSequence s1;
+        EXPECT_CALL(
+            *opaque_component, 
+            do_draw(_, terminalpp::rectangle({0, 0}, {2, 2})));
+        EXPECT_CALL(
+            *later_component, 
+            do_draw(_, terminalpp::rectangle({0, 0}, {2, 2})));
+    }
+
+    container.draw(surface, terminalpp::rectangle({0, 0}, {2, 2}));
+}
@@ -52,6 +52,43 @@ TEST_F(a_container_with_two_components_where_the_last_has_focus, skips_the_first
     container.event('X');
 }
 
+TEST_F(a_container_with_two_components_where_the_last_has_focus, remembers_the_focussed_subcomponent_when_forwarding_events)
+{
+    EXPECT_CALL(*component0, do_has_focus())
+        .WillOnce(Return(false));
+
+    EXPECT_CALL(*component1, do_has_focus())
+        .WillRepeatedly(Return(true));
+
+    EXPECT_CALL(*component1, do_event(_))
+        .Times(3);
+
+    container.event('X');
+    container.event('Y');
+    container.event('Z');
+}
+
+TEST_F(a_container_with_two_components_where_the_last_has_focus, forwards_events_to_a_newly_focussed_subcomponent)
+{
+    EXPECT_CALL(*component0, do_has_focus())
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*component1, do_has_focus())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*component1, do_event(_));
+
+    container.event('X');
+
+    // Focus moves from the last component to the first without the 
+    // container being told.
+    EXPECT_CALL(*component0, do_has_focus())
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*component1, do_has_focus())
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*component0, do_event(_));
+
+    container.event('Y');
+}
+
 TEST_F(a_container_with_one_component, forwards_mouse_events_even_though_the_component_has_no_focus)
 {
     static terminalpp::ansi::mouse::report const report {
@@ -1,11 +1,16 @@
 #include "container_test.hpp"
 #include "mock/layout.hpp"
+#include <munin/grid_layout.hpp>
+#include <munin/image.hpp>
+#include <munin/vertical_strip_layout.hpp>
+#include <munin/view.hpp>
 
 using testing::_;
 using testing::DoAll;
 using testing::InSequence;
 using testing::Invoke;
 using testing::Return;
+using namespace terminalpp::literals;
 
 TEST(a_container_with_no_elements, does_not_lay_the_container_out_when_a_component_is_added)
 {
@@ -15,6 +20,7 @@ TEST(a_container_with_no_elements, does_not_lay_the_container_out_when_a_compone
 
     EXPECT_CALL(*layout, do_layout(_, _, _));
     container.set_layout(std::move(layout));
+    container.flush_layout();
 }
 
 TEST(a_container_with_elements, lays_the_container_out_when_a_component_is_added)
@@ -27,6 +33,7 @@ TEST(a_container_with_elements, lays_the_container_out_when_a_component_is_added
 
     EXPECT_CALL(*layout, do_layout(_, _, _));
     container.set_layout(std::move(layout));
+    container.flush_layout();
 }
 
 TEST_F(a_container, lays_out_the_container_when_a_component_is_added)
@@ -41,7 +48,9 @@ TEST_F(a_container, lays_out_the_container_when_a_component_is_added)
 
     container.set_size(size);
     container.set_layout(std::move(layout));
+    container.flush_layout();
     container.add_component(component, hint);
+    container.flush_layout();
 }
 
 TEST_F(a_container, reports_a_preferred_size_change_when_a_component_is_added)
@@ -63,8 +72,10 @@ TEST_F(a_container, lays_out_the_container_when_a_component_is_removed)
         .Times(2);
 
     container.set_layout(std::move(layout));
+    container.flush_layout();
 
     container.remove_component(component);
+    container.flush_layout();
 }
 
 TEST_F(a_container, lays_out_the_container_when_its_size_is_changed)
@@ -75,7 +86,26 @@ TEST_F(a_container, lays_out_the_container_when_its_size_is_changed)
         .Times(2);
 
     container.set_layout(std::move(layout));
+    container.flush_layout();
     container.set_size({1, 1});
+    container.flush_layout();
+}
+
+TEST_F(a_container, does_not_lay_out_the_container_when_its_size_is_unchanged)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+
+    EXPECT_CALL(*layout, do_layout(_, _, _))
+        .Times(1);
+
+    container.set_layout(std::move(layout));
+    container.set_size({1, 1});
+    container.flush_layout();
+    ResetCounters();
+
+    container.set_size({1, 1});
+    container.flush_layout();
+    ASSERT_EQ(0, redraw_count);
 }
 
 TEST_F(a_container, has_the_preferred_size_of_its_layout)
@@ -95,7 +125,227 @@ TEST_F(a_container, has_the_preferred_size_of_its_layout)
 
     container.add_component(component, hint);
     container.set_layout(std::move(layout));
-
+    container.flush_layout();
 
     ASSERT_EQ(expected_result, container.get_preferred_size());
 }
+
+TEST_F(a_container, lays_out_the_container_once_when_several_components_are_added)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component0 = std::make_shared<mock_component>();
+    auto component1 = std::make_shared<mock_component>();
+    auto component2 = std::make_shared<mock_component>();
+
+    container.set_size({80, 24});
+
+    EXPECT_CALL(*layout, do_layout(testing::SizeIs(3), testing::SizeIs(3), _))
+        .WillOnce(Invoke(
+            [](auto const &, auto const &hints, auto)
+            {
+                ASSERT_EQ(
+                    std::string{"hint0"}, 
+                    boost::any_cast<std::string>(
+                        boost::get<boost::any>(hints[0])));
+                ASSERT_EQ(
+                    std::string{"hint1"}, 
+                    boost::any_cast<std::string>(
+                        boost::get<boost::any>(hints[1])));
+                ASSERT_NE(nullptr, boost::get<boost::blank>(&hints[2]));
+            }));
+
+    container.set_layout(std::move(layout));
+    ResetCounters();
+
+    container.add_components(
+        {component0, component1, component2}, 
+        {std::string{"hint0"}, std::string{"hint1"}});
+    container.flush_layout();
+
+    ASSERT_EQ(1, preferred_size_changed_count);
+}
+
+TEST_F(a_container, does_nothing_when_no_components_are_added)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+
+    EXPECT_CALL(*layout, do_layout(_, _, _));
+
+    container.set_layout(std::move(layout));
+    container.flush_layout();
+    ResetCounters();
+
+    container.add_components({});
+    container.flush_layout();
+
+    ASSERT_EQ(0, preferred_size_changed_count);
+}
+
+TEST(a_view, lays_out_its_container_once_with_all_of_its_components)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component0 = std::make_shared<mock_component>();
+    auto component1 = std::make_shared<mock_component>();
+
+    EXPECT_CALL(*layout, do_layout(testing::SizeIs(2), _, _))
+        .WillOnce(Invoke(
+            [](auto const &, auto const &hints, auto)
+            {
+                ASSERT_NE(nullptr, boost::get<boost::blank>(&hints[0]));
+                ASSERT_EQ(
+                    std::string{"hint1"}, 
+                    boost::any_cast<std::string>(
+                        boost::get<boost::any>(hints[1])));
+            }));
+
+    auto view = munin::view(
+        std::move(layout),
+        component0,
+        component1, std::string{"hint1"});
+    view->flush_layout();
+}
+
+TEST_F(a_container, does_not_lay_out_the_container_until_it_is_needed)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component = std::make_shared<mock_component>();
+
+    EXPECT_CALL(*layout, do_layout(_, _, _)).Times(0);
+
+    container.set_layout(std::move(layout));
+    container.set_size({80, 24});
+    container.add_component(component);
+    container.remove_component(component);
+}
+
+TEST_F(a_container, lays_out_the_container_once_for_several_changes)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component = std::make_shared<mock_component>();
+
+    EXPECT_CALL(*layout, do_layout(_, _, terminalpp::extent(100, 50)));
+
+    container.set_layout(std::move(layout));
+    container.add_component(component);
+    container.set_size({80, 24});
+    container.set_size({90, 30});
+    container.set_size({100, 50});
+
+    container.flush_layout();
+    container.flush_layout();
+}
+
+TEST_F(a_container, lays_out_the_container_before_it_is_drawn)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component = std::make_shared<mock_component>();
+
+    bool laid_out = false;
+    EXPECT_CALL(*layout, do_layout(_, _, _))
+        .WillOnce(Invoke(
+            [&laid_out](auto const &, auto const &, auto)
+            {
+                laid_out = true;
+            }));
+
+    container.set_layout(std::move(layout));
+    container.add_component(component);
+    container.set_size({2, 2});
+
+    ON_CALL(*component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(2, 2)));
+
+    EXPECT_CALL(*component, do_draw(_, _))
+        .WillOnce(Invoke(
+            [&laid_out](auto &, auto const &)
+            {
+                ASSERT_TRUE(laid_out);
+            }));
+
+    terminalpp::canvas canvas({2, 2});
+    munin::render_surface surface{canvas};
+    container.draw(surface, {{0, 0}, {2, 2}});
+}
+
+TEST_F(a_container, lays_out_the_container_before_passing_on_an_event)
+{
+    auto layout = std::unique_ptr<mock_layout>(new mock_layout);
+    auto component = std::make_shared<mock_component>();
+
+    bool laid_out = false;
+    EXPECT_CALL(*layout, do_layout(_, _, _))
+        .WillOnce(Invoke(
+            [&laid_out](auto const &, auto const &, auto)
+            {
+                laid_out = true;
+            }));
+
+    container.set_layout(std::move(layout));
+    container.add_component(component);
+
+    ON_CALL(*component, do_has_focus())
+        .WillByDefault(Return(true));
+
+    EXPECT_CALL(*component, do_event(_))
+        .WillOnce(Invoke(
+            [&laid_out](auto const &)
+            {
+                ASSERT_TRUE(laid_out);
+            }));
+
+    container.event('x');
+}
+
+TEST_F(a_container, requests_a_redraw_of_itself_when_its_layout_is_invalidated)
+{
+    std::vector<terminalpp::rectangle> redraw_regions;
+    container.on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.insert(
+                redraw_regions.end(), regions.begin(), regions.end());
+        });
+
+    container.set_size({4, 3});
+    ASSERT_EQ(
+        std::vector<terminalpp::rectangle>{
+            terminalpp::rectangle({0, 0}, {4, 3})},
+        redraw_regions);
+}
+
+TEST(a_nested_container, lays_out_again_when_a_subcomponent_changes_its_preferred_size)
+{
+    auto const left = munin::make_image("a"_ts);
+    auto const right = munin::make_image("b"_ts);
+    auto const inner = munin::view(
+        munin::make_vertical_strip_layout(), left, right);
+    auto const outer = munin::view(munin::make_grid_layout({1, 1}), inner);
+
+    outer->set_size({4, 1});
+    outer->flush_layout();
+    inner->flush_layout();
+    ASSERT_EQ(terminalpp::point(1, 0), right->get_position());
+
+    // The size of the inner container does not change, but the geometry 
+    // of its subcomponents must.
+    left->set_content("aa"_ts);
+    outer->flush_layout();
+    inner->flush_layout();
+
+    ASSERT_EQ(terminalpp::extent(4, 1), inner->get_size());
+    ASSERT_EQ(terminalpp::point(2, 0), right->get_position());
+}
+
+TEST(a_nested_container, lays_out_every_pending_level_when_a_subcomponents_geometry_is_read)
+{
+    auto const left = munin::make_image("a"_ts);
+    auto const right = munin::make_image("b"_ts);
+    auto const inner = munin::view(
+        munin::make_vertical_strip_layout(), left, right);
+    auto const outer = munin::view(munin::make_grid_layout({1, 1}), inner);
+
+    outer->set_size({4, 1});
+
+    ASSERT_EQ(terminalpp::point(1, 0), right->get_position());
+    ASSERT_EQ(terminalpp::extent(1, 1), right->get_size());
+}
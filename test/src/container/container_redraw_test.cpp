@@ -1,28 +1,101 @@
 #include "container_test.hpp"
 #include "redraw.hpp"
+#include <munin/edit.hpp>
+#include <munin/framed_component.hpp>
+#include <munin/image.hpp>
+#include <munin/solid_frame.hpp>
+#include <munin/vertical_strip_layout.hpp>
+#include <munin/view.hpp>
 
 using testing::Return;
+using namespace terminalpp::literals;
 
 TEST_F(a_container_with_one_component, requests_redraws_relative_to_component_position_when_subcomponent_requests_redraws)
 {
     static auto const redraw_region      = terminalpp::rectangle{{0,0}, {10,5}};
     static auto const component_position = terminalpp::point{2, 3};
+
+    container.set_size({20, 20});
+    ResetCounters();
     
     container.on_redraw.connect(
         [](auto const &redraw_regions)
         {
             static auto const expected_redraw_region = terminalpp::rectangle{{2, 3}, {10,5}};
-            assert_equivalent_redraw_regions(redraw_regions, {expected_redraw_region});
+            assert_equivalent_redraw_regions({expected_redraw_region}, redraw_regions);
         });
         
     EXPECT_CALL(*component, do_get_position())
         .WillRepeatedly(Return(component_position));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent{10, 5}));
         
     component->on_redraw({redraw_region});
     
     ASSERT_EQ(1, redraw_count);
 }
 
+TEST_F(a_container_with_one_component, clips_redraw_regions_to_the_bounds_of_the_subcomponent)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(2, 3)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(4, 2)));
+
+    container.set_size({20, 20});
+    ResetCounters();
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    container.on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.assign(regions.begin(), regions.end());
+        });
+
+    component->on_redraw({{{1, 1}, {10, 10}}});
+
+    ASSERT_EQ(1, redraw_count);
+    assert_equivalent_redraw_regions({{{3, 4}, {3, 1}}}, redraw_regions);
+}
+
+TEST_F(a_container_with_one_component, clips_redraw_regions_to_the_bounds_of_the_container)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(8, 8)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(5, 5)));
+
+    container.set_size({10, 10});
+    ResetCounters();
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    container.on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.assign(regions.begin(), regions.end());
+        });
+
+    component->on_redraw({{{0, 0}, {5, 5}}});
+
+    ASSERT_EQ(1, redraw_count);
+    assert_equivalent_redraw_regions({{{8, 8}, {2, 2}}}, redraw_regions);
+}
+
+TEST_F(a_container_with_one_component, does_not_emit_redraw_event_when_subcomponent_redraws_outside_itself)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(0, 0)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(4, 4)));
+
+    container.set_size({10, 10});
+    ResetCounters();
+
+    component->on_redraw({{{5, 5}, {2, 2}}});
+
+    ASSERT_EQ(0, redraw_count);
+}
+
 TEST_F(a_container_with_one_component, does_not_emit_redraw_event_when_removed_component_emits_redraw_event)
 {
     EXPECT_CALL(*component, do_get_position())
@@ -34,3 +107,167 @@ TEST_F(a_container_with_one_component, does_not_emit_redraw_event_when_removed_c
     
     ASSERT_EQ(0, redraw_count);
 }
+
+TEST(a_nested_container, translates_redraw_regions_through_every_level)
+{
+    auto const component = std::make_shared<mock_component>();
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(2, 1)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(4, 4)));
+
+    auto const inner = std::make_shared<munin::container>();
+    inner->add_component(component);
+    inner->set_position({3, 2});
+    inner->set_size({10, 10});
+
+    munin::container outer;
+    outer.add_component(inner);
+    outer.set_size({20, 20});
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    outer.on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.assign(regions.begin(), regions.end());
+        });
+
+    component->on_redraw({{{1, 1}, {2, 2}}});
+
+    assert_equivalent_redraw_regions({{{6, 4}, {2, 2}}}, redraw_regions);
+}
+
+TEST_F(a_container_with_one_component, passes_on_scrolls_relative_to_component_position)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(2, 3)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(5, 5)));
+
+    container.set_size({20, 20});
+
+    boost::optional<std::pair<terminalpp::rectangle, terminalpp::coordinate_type>> 
+        scroll;
+    container.on_scroll.connect(
+        [&scroll](auto const &region, auto rows)
+        {
+            scroll = std::make_pair(region, rows);
+            return true;
+        });
+
+    auto const accepted = 
+        component->on_scroll({{0, 1}, {5, 4}}, 2).get_value_or(false);
+
+    ASSERT_TRUE(accepted);
+    ASSERT_EQ(
+        std::make_pair(terminalpp::rectangle{{2, 4}, {5, 4}}, 2), 
+        *scroll);
+}
+
+TEST_F(a_container_with_one_component, refuses_scrolls_that_are_partly_out_of_sight)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(8, 8)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(5, 5)));
+
+    container.set_size({10, 10});
+
+    bool scroll_passed_on = false;
+    container.on_scroll.connect(
+        [&scroll_passed_on](auto const &, auto)
+        {
+            scroll_passed_on = true;
+            return true;
+        });
+
+    auto const accepted = 
+        component->on_scroll({{0, 0}, {5, 5}}, 1).get_value_or(false);
+
+    ASSERT_FALSE(accepted);
+    ASSERT_FALSE(scroll_passed_on);
+}
+
+TEST_F(a_container_with_two_components, refuses_scrolls_that_another_component_overlaps)
+{
+    EXPECT_CALL(*component0, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(0, 0)));
+    EXPECT_CALL(*component0, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(10, 10)));
+    EXPECT_CALL(*component1, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(5, 5)));
+    EXPECT_CALL(*component1, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(2, 2)));
+
+    container.set_size({10, 10});
+
+    container.on_scroll.connect(
+        [](auto const &, auto)
+        {
+            return true;
+        });
+
+    auto const accepted = 
+        component0->on_scroll({{0, 0}, {10, 10}}, 1).get_value_or(false);
+
+    ASSERT_FALSE(accepted);
+}
+
+TEST(a_framed_edit, redraws_only_the_edit_when_text_is_typed)
+{
+    auto const edit = munin::make_edit();
+    auto const framed = munin::make_framed_component(
+        munin::make_solid_frame(), edit);
+
+    framed->set_size({10, 3});
+    framed->flush_layout();
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    framed->on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.insert(
+                redraw_regions.end(), regions.begin(), regions.end());
+        });
+
+    // Typing changes the preferred size of the edit, but not where it is
+    // laid out, so only the text that changed is redrawn.
+    edit->insert_text("a");
+
+    ASSERT_EQ(
+        std::vector<terminalpp::rectangle>{
+            terminalpp::rectangle({1, 1}, {1, 1})},
+        redraw_regions);
+}
+
+TEST(a_container, redraws_only_the_subcomponents_moved_by_a_preferred_size_change)
+{
+    auto const left = munin::make_image("a"_ts);
+    auto const middle = munin::make_image("b"_ts);
+    auto const right = munin::make_image("c"_ts);
+    auto const container = munin::view(
+        munin::make_vertical_strip_layout(), left, middle, right);
+
+    container->set_size({6, 1});
+    container->flush_layout();
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    container->on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.insert(
+                redraw_regions.end(), regions.begin(), regions.end());
+        });
+
+    // The middle image grows, which moves the right image along.  The 
+    // left image is untouched, and so is not redrawn.
+    middle->set_content("bb"_ts);
+    container->flush_layout();
+
+    for (auto const &region : redraw_regions)
+    {
+        ASSERT_GE(region.origin.x, 1);
+    }
+
+    ASSERT_FALSE(redraw_regions.empty());
+}
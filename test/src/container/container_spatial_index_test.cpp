@@ -0,0 +1,221 @@
+#include "mock/component.hpp"
+#include <munin/container.hpp>
+#include <munin/grid_layout.hpp>
+#include <munin/render_surface.hpp>
+#include <terminalpp/ansi/mouse.hpp>
+#include <terminalpp/canvas.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+using testing::ReturnPointee;
+
+namespace {
+
+struct geometry
+{
+    terminalpp::point  position;
+    terminalpp::extent size;
+};
+
+class a_container_with_many_components : public testing::Test
+{
+protected :
+    // An 8x8 grid of components, each of which is 2x2 in size.
+    static constexpr int grid_dimension = 8;
+
+    void SetUp() override
+    {
+        container.set_size({16, 16});
+        container.set_layout(
+            munin::make_grid_layout({grid_dimension, grid_dimension}));
+
+        geometries.resize(grid_dimension * grid_dimension);
+
+        for (auto &geom : geometries)
+        {
+            auto comp = std::make_shared<mock_component>();
+
+            ON_CALL(*comp, do_set_position(_))
+                .WillByDefault(Invoke(
+                    [&geom](terminalpp::point const &pos)
+                    {
+                        geom.position = pos;
+                    }));
+            ON_CALL(*comp, do_get_position())
+                .WillByDefault(ReturnPointee(&geom.position));
+            ON_CALL(*comp, do_set_size(_))
+                .WillByDefault(Invoke(
+                    [&geom](terminalpp::extent const &size)
+                    {
+                        geom.size = size;
+                    }));
+            ON_CALL(*comp, do_get_size())
+                .WillByDefault(ReturnPointee(&geom.size));
+
+            EXPECT_CALL(*comp, do_set_position(_)).Times(AnyNumber());
+            EXPECT_CALL(*comp, do_get_position()).Times(AnyNumber());
+            EXPECT_CALL(*comp, do_set_size(_)).Times(AnyNumber());
+            EXPECT_CALL(*comp, do_get_size()).Times(AnyNumber());
+
+            container.add_component(comp);
+            components.push_back(comp);
+        }
+    }
+
+    munin::container container;
+    std::vector<geometry> geometries;
+    std::vector<std::shared_ptr<mock_component>> components;
+};
+
+constexpr int a_container_with_many_components::grid_dimension;
+
+}
+
+TEST_F(a_container_with_many_components, draws_only_components_within_the_draw_region)
+{
+    terminalpp::canvas canvas({16, 16});
+    munin::render_surface surface{canvas};
+
+    for (auto index = 0; index < components.size(); ++index)
+    {
+        // The region {3,3}-{5,5} covers the components at grid positions
+        // (1,1), (2,1), (1,2) and (2,2).
+        if (index == 9 || index == 10 || index == 17 || index == 18)
+        {
+            continue;
+        }
+
+        EXPECT_CALL(*components[index], do_draw(_, _)).Times(0);
+    }
+
+    EXPECT_CALL(*components[9], do_draw(_, terminalpp::rectangle({1, 1}, {1, 1})));
+    EXPECT_CALL(*components[10], do_draw(_, terminalpp::rectangle({0, 1}, {1, 1})));
+    EXPECT_CALL(*components[17], do_draw(_, terminalpp::rectangle({1, 0}, {1, 1})));
+    EXPECT_CALL(*components[18], do_draw(_, terminalpp::rectangle({0, 0}, {1, 1})));
+
+    container.draw(surface, terminalpp::rectangle({3, 3}, {2, 2}));
+}
+
+TEST_F(a_container_with_many_components, draws_every_component_when_fully_drawn)
+{
+    terminalpp::canvas canvas({16, 16});
+    munin::render_surface surface{canvas};
+
+    for (auto const &comp : components)
+    {
+        EXPECT_CALL(*comp, do_draw(_, terminalpp::rectangle({0, 0}, {2, 2})));
+    }
+
+    container.draw(surface, terminalpp::rectangle({0, 0}, {16, 16}));
+}
+
+TEST_F(a_container_with_many_components, sends_mouse_events_to_the_component_at_the_event_location)
+{
+    auto const report = terminalpp::ansi::mouse::report{
+        terminalpp::ansi::mouse::report::LEFT_BUTTON_DOWN, 5, 7
+    };
+
+    for (auto index = 0; index < components.size(); ++index)
+    {
+        if (index != 26)
+        {
+            EXPECT_CALL(*components[index], do_event(_)).Times(0);
+        }
+    }
+
+    // (5, 7) lies within the component at grid position (2, 3), at an
+    // offset of (1, 1) within it.
+    boost::any received_event;
+    EXPECT_CALL(*components[26], do_event(_))
+        .WillOnce(Invoke(
+            [&received_event](boost::any const &ev)
+            {
+                received_event = ev;
+            }));
+
+    container.event(report);
+
+    auto const *received_report = 
+        boost::any_cast<terminalpp::ansi::mouse::report>(&received_event);
+    ASSERT_NE(nullptr, received_report);
+    ASSERT_EQ(1, received_report->x_position_);
+    ASSERT_EQ(1, received_report->y_position_);
+}
+
+TEST_F(a_container_with_many_components, reindexes_components_after_relayout)
+{
+    container.set_size({8, 8});
+
+    terminalpp::canvas canvas({8, 8});
+    munin::render_surface surface{canvas};
+
+    // Each component is now 1x1, so the bottom-right cell is the last
+    // component.
+    for (auto index = 0; index < components.size() - 1; ++index)
+    {
+        EXPECT_CALL(*components[index], do_draw(_, _)).Times(0);
+    }
+
+    EXPECT_CALL(
+        *components.back(), do_draw(_, terminalpp::rectangle({0, 0}, {1, 1})));
+
+    container.draw(surface, terminalpp::rectangle({7, 7}, {1, 1}));
+}
+
+TEST_F(a_container_with_many_components, draws_components_that_span_many_rows)
+{
+    // Each component is now a column, one wide and the full height of the
+    // container, so all of them begin well above the draw region.
+    container.set_size({64, 16});
+    container.set_layout(
+        munin::make_grid_layout({grid_dimension * grid_dimension, 1}));
+
+    terminalpp::canvas canvas({64, 16});
+    munin::render_surface surface{canvas};
+
+    for (auto index = 0; index < components.size(); ++index)
+    {
+        if (index != 5 && index != 6)
+        {
+            EXPECT_CALL(*components[index], do_draw(_, _)).Times(0);
+        }
+    }
+
+    EXPECT_CALL(
+        *components[5], do_draw(_, terminalpp::rectangle({0, 10}, {1, 3})));
+    EXPECT_CALL(
+        *components[6], do_draw(_, terminalpp::rectangle({0, 10}, {1, 3})));
+
+    container.draw(surface, terminalpp::rectangle({5, 10}, {2, 3}));
+}
+
+TEST_F(a_container_with_many_components, draws_a_tall_component_alongside_short_ones)
+{
+    // The first component is stretched to the full height of the 
+    // container, as a sidebar would be, so it reaches far below the row
+    // that it begins on, where the region to be drawn is.
+    ON_CALL(*components[0], do_get_size())
+        .WillByDefault(testing::Return(terminalpp::extent{2, 16}));
+
+    terminalpp::canvas canvas({16, 16});
+    munin::render_surface surface{canvas};
+
+    for (auto index = 0; index < components.size(); ++index)
+    {
+        if (index != 0 && index != 48)
+        {
+            EXPECT_CALL(*components[index], do_draw(_, _)).Times(0);
+        }
+    }
+
+    EXPECT_CALL(
+        *components[0], do_draw(_, terminalpp::rectangle({1, 12}, {1, 1})));
+    EXPECT_CALL(
+        *components[48], do_draw(_, terminalpp::rectangle({1, 0}, {1, 1})));
+
+    container.draw(surface, terminalpp::rectangle({1, 12}, {1, 1}));
+}
@@ -1,4 +1,5 @@
 #include "container_test.hpp"
+#include <munin/edit.hpp>
 
 using testing::InSequence;
 using testing::Invoke;
@@ -75,3 +76,32 @@ TEST_F(a_container_with_two_components_where_the_last_has_focus, removes_focus_f
     ASSERT_EQ(0, focus_set_count);
     ASSERT_EQ(0, focus_lost_count);
 }
+
+TEST(a_container_whose_subcomponent_takes_focus_directly, moves_focus_onward_from_that_subcomponent)
+{
+    auto const first = munin::make_edit();
+    auto const second = munin::make_edit();
+    auto const third = munin::make_edit();
+
+    munin::container container;
+    container.add_component(first);
+    container.add_component(second);
+    container.add_component(third);
+
+    container.set_focus();
+    ASSERT_TRUE(first->has_focus());
+
+    third->set_focus();
+    ASSERT_FALSE(first->has_focus());
+    ASSERT_TRUE(third->has_focus());
+
+    container.focus_previous();
+    ASSERT_TRUE(container.has_focus());
+    ASSERT_FALSE(third->has_focus());
+    ASSERT_TRUE(second->has_focus());
+
+    container.focus_next();
+    ASSERT_TRUE(container.has_focus());
+    ASSERT_FALSE(second->has_focus());
+    ASSERT_TRUE(third->has_focus());
+}
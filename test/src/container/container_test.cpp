@@ -1,4 +1,5 @@
 #include "container_test.hpp"
+#include <munin/null_layout.hpp>
 #include <munin/render_surface.hpp>
 
 using testing::Return;
@@ -82,3 +83,24 @@ TEST_F(a_container_with_one_component, reports_a_preferred_size_change_when_a_co
     ASSERT_EQ(1, preferred_size_changed_count);
 }
 
+
+TEST_F(a_container_with_one_component, reports_a_preferred_size_change_when_its_component_does)
+{
+    component->on_preferred_size_changed();
+    ASSERT_EQ(1, preferred_size_changed_count);
+}
+
+TEST_F(a_container_with_one_component, reports_a_preferred_size_change_when_its_layout_is_changed)
+{
+    container.set_layout(munin::make_null_layout());
+    ASSERT_EQ(1, preferred_size_changed_count);
+}
+
+TEST_F(a_container_with_one_component, does_not_report_preferred_size_changes_of_removed_components)
+{
+    container.remove_component(component);
+    ResetCounters();
+
+    component->on_preferred_size_changed();
+    ASSERT_EQ(0, preferred_size_changed_count);
+}
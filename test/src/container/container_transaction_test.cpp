@@ -0,0 +1,142 @@
+#include "container_test.hpp"
+#include "redraw.hpp"
+#include <munin/update_transaction.hpp>
+
+using testing::Return;
+
+TEST_F(a_container_with_one_component, defers_redraws_until_the_end_of_a_transaction)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(2, 3)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(2, 1)));
+
+    container.set_size({10, 10});
+    ResetCounters();
+
+    std::vector<terminalpp::rectangle> redraw_regions;
+    container.on_redraw.connect(
+        [&redraw_regions](auto const &regions)
+        {
+            redraw_regions.assign(regions.begin(), regions.end());
+        });
+    
+    {
+        munin::update_transaction transaction;
+        
+        component->on_redraw({{{0, 0}, {1, 1}}});
+        component->on_redraw({{{1, 0}, {1, 1}}});
+        component->on_redraw({{{0, 0}, {2, 1}}});
+
+        ASSERT_EQ(0, redraw_count);
+    }
+
+    ASSERT_EQ(1, redraw_count);
+    assert_equivalent_redraw_regions({{{2, 3}, {2, 1}}}, redraw_regions);
+}
+
+TEST_F(a_container_with_one_component, defers_redraws_until_the_end_of_the_outermost_transaction)
+{
+    EXPECT_CALL(*component, do_get_position())
+        .WillRepeatedly(Return(terminalpp::point(0, 0)));
+    EXPECT_CALL(*component, do_get_size())
+        .WillRepeatedly(Return(terminalpp::extent(1, 1)));
+
+    container.set_size({10, 10});
+    ResetCounters();
+
+    {
+        munin::update_transaction outer_transaction;
+
+        {
+            munin::update_transaction inner_transaction;
+            component->on_redraw({{{0, 0}, {1, 1}}});
+        }
+
+        ASSERT_EQ(0, redraw_count);
+    }
+
+    ASSERT_EQ(1, redraw_count);
+}
+
+TEST_F(a_container_with_one_component, does_not_announce_redraws_when_no_redraws_occurred_during_a_transaction)
+{
+    {
+        munin::update_transaction transaction;
+    }
+
+    ASSERT_EQ(0, redraw_count);
+    ASSERT_EQ(0, cursor_position_changed_count);
+    ASSERT_EQ(0, cursor_state_changed_count);
+}
+
+TEST_F(a_container_with_one_component_that_has_focus, defers_cursor_changes_until_the_end_of_a_transaction)
+{
+    EXPECT_CALL(*component, do_has_focus())
+        .WillRepeatedly(Return(true));
+
+    {
+        munin::update_transaction transaction;
+
+        component->on_cursor_position_changed();
+        component->on_cursor_state_changed();
+        component->on_cursor_position_changed();
+
+        ASSERT_EQ(0, cursor_position_changed_count);
+        ASSERT_EQ(0, cursor_state_changed_count);
+    }
+
+    ASSERT_EQ(1, cursor_position_changed_count);
+    ASSERT_EQ(1, cursor_state_changed_count);
+}
+
+TEST(a_nested_container, passes_one_deferred_redraw_to_its_parent)
+{
+    auto const component = std::make_shared<mock_component>();
+    ON_CALL(*component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+    ON_CALL(*component, do_get_size())
+        .WillByDefault(Return(terminalpp::extent(10, 1)));
+
+    auto const inner = munin::make_container();
+    inner->add_component(component);
+    inner->set_size({10, 1});
+
+    munin::container outer;
+    outer.add_component(inner);
+    outer.set_size({10, 1});
+
+    int redraw_count = 0;
+    outer.on_redraw.connect(
+        [&redraw_count](auto const &)
+        {
+            ++redraw_count;
+        });
+
+    {
+        munin::update_transaction transaction;
+
+        for (int x = 0; x < 10; ++x)
+        {
+            component->on_redraw({{{x, 0}, {1, 1}}});
+        }
+    }
+
+    ASSERT_EQ(1, redraw_count);
+}
+
+TEST(a_container_destroyed_during_a_transaction, announces_nothing)
+{
+    auto const component = std::make_shared<mock_component>();
+    ON_CALL(*component, do_get_position())
+        .WillByDefault(Return(terminalpp::point(0, 0)));
+
+    munin::update_transaction transaction;
+    
+    {
+        munin::container container;
+        container.add_component(component);
+        component->on_redraw({{{0, 0}, {1, 1}}});
+        container.remove_component(component);
+    }
+}
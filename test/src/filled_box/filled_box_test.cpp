@@ -24,6 +24,12 @@ TEST(a_filled_box, can_have_its_preferred_size_set)
     ASSERT_EQ(1, called);
 }
 
+TEST(a_filled_box, is_opaque)
+{
+    munin::filled_box filled_box;
+    ASSERT_TRUE(filled_box.is_opaque());
+}
+
 TEST(a_filled_box, draws_its_fill)
 {
     munin::filled_box filled_box('Y');
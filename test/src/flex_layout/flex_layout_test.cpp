@@ -0,0 +1,286 @@
+#include "layout_hint_printer.hpp"
+#include "mock/component.hpp"
+#include <munin/flex_layout.hpp>
+#include <terminalpp/rectangle.hpp>
+#include <gtest/gtest.h>
+
+using testing::Return;
+using testing::ValuesIn;
+
+TEST(make_flex_layout, creates_a_new_flex_layout)
+{
+    auto lyt = munin::make_flex_layout(munin::flex_direction::row);
+    ASSERT_NE(nullptr, dynamic_cast<munin::flex_layout*>(lyt.get()));
+}
+
+TEST(flex_layout_test, reports_attributes_as_json)
+{
+    munin::flex_layout fl(munin::flex_direction::column);
+    munin::layout &lyt = fl;
+
+    nlohmann::json json = lyt.to_json();
+
+    ASSERT_EQ("flex_layout", json["type"]);
+    ASSERT_EQ("column", json["direction"]);
+}
+
+TEST(a_flex_layout_with_no_components, has_a_zero_preferred_size)
+{
+    munin::flex_layout layout(munin::flex_direction::row);
+    ASSERT_EQ(terminalpp::extent(0, 0), layout.get_preferred_size({}, {}));
+}
+
+using flex_layout_component_data = std::tuple<
+    terminalpp::extent,   // preferred size
+    munin::layout_hint,   // layout hint
+    terminalpp::rectangle // expected placement
+>;
+
+using flex_layout_test_data = std::tuple<
+    munin::flex_direction,                   // direction
+    std::vector<flex_layout_component_data>, // component data
+    terminalpp::extent,                      // container size
+    terminalpp::extent                       // preferred size
+>;
+
+class flex_layouts
+  : public testing::TestWithParam<flex_layout_test_data>
+{
+};
+
+TEST_P(flex_layouts, place_components_at_these_positions)
+{
+    auto const &param = GetParam();
+    auto const &direction               = std::get<0>(param);
+    auto const &component_data          = std::get<1>(param);
+    auto const &container_size          = std::get<2>(param);
+    auto const &expected_preferred_size = std::get<3>(param);
+
+    std::vector<std::shared_ptr<munin::component>> components;
+    std::vector<munin::layout_hint> hints;
+
+    for (auto const &component_datum : component_data)
+    {
+        auto const &preferred_size     = std::get<0>(component_datum);
+        auto const &hint               = std::get<1>(component_datum);
+        auto const &expected_placement = std::get<2>(component_datum);
+
+        auto component = std::make_shared<mock_component>();
+        EXPECT_CALL(*component, do_get_preferred_size())
+            .WillRepeatedly(Return(preferred_size));
+        EXPECT_CALL(*component, do_set_position(expected_placement.origin));
+        EXPECT_CALL(*component, do_set_size(expected_placement.size));
+
+        components.push_back(component);
+        hints.push_back(hint);
+    }
+
+    auto lyt = munin::make_flex_layout(direction);
+
+    ASSERT_EQ(expected_preferred_size, lyt->get_preferred_size(components, hints));
+    (*lyt)(components, hints, container_size);
+}
+
+static auto const row    = munin::flex_direction::row;
+static auto const column = munin::flex_direction::column;
+
+INSTANTIATE_TEST_SUITE_P(
+    tracks_are_sized_by_their_basis,
+    flex_layouts,
+    ValuesIn(
+    {
+        // Components with no hint are given their preferred size.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 3, 1 }, {}, { { 0, 0 }, { 3, 2 } }
+                },
+                flex_layout_component_data {
+                    { 4, 2 }, {}, { { 3, 0 }, { 4, 2 } }
+                },
+            },
+            { 10, 2 },
+            { 7, 2 }
+        },
+
+        // Fixed tracks ignore the preferred size.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 3, 1 }, munin::fixed_track(1), { { 0, 0 }, { 1, 1 } }
+                },
+                flex_layout_component_data {
+                    { 3, 1 }, munin::fixed_track(2), { { 1, 0 }, { 2, 1 } }
+                },
+            },
+            { 10, 1 },
+            { 3, 1 }
+        },
+
+        // Weighted tracks share what is left in proportion to their
+        // weights, and always use all of it.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(1), { { 0, 0 }, { 1, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::weighted_track(1), { { 1, 0 }, { 3, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::weighted_track(2), { { 4, 0 }, { 6, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(1), { { 10, 0 }, { 1, 1 } }
+                },
+            },
+            { 11, 1 },
+            { 4, 1 }
+        },
+
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 0, 0 }, munin::weighted_track(), { { 0, 0 }, { 3, 1 } }
+                },
+                flex_layout_component_data {
+                    { 0, 0 }, munin::weighted_track(), { { 3, 0 }, { 3, 1 } }
+                },
+                flex_layout_component_data {
+                    { 0, 0 }, munin::weighted_track(), { { 6, 0 }, { 4, 1 } }
+                },
+            },
+            { 10, 1 },
+            { 0, 0 }
+        },
+
+        // Columns place their components from top to bottom.
+        flex_layout_test_data {
+            column,
+            {
+                flex_layout_component_data {
+                    { 2, 2 }, munin::preferred_track(), { { 0, 0 }, { 5, 2 } }
+                },
+                flex_layout_component_data {
+                    { 3, 1 }, munin::weighted_track(), { { 0, 2 }, { 5, 8 } }
+                },
+            },
+            { 5, 10 },
+            { 3, 3 }
+        },
+    }
+));
+
+INSTANTIATE_TEST_SUITE_P(
+    tracks_respect_their_bounds,
+    flex_layouts,
+    ValuesIn(
+    {
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 8, 1 }, munin::preferred_track(0, 5), { { 0, 0 }, { 5, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::preferred_track(3), { { 5, 0 }, { 3, 1 } }
+                },
+            },
+            { 10, 1 },
+            { 8, 1 }
+        },
+
+        // Space a weighted track cannot take is left unused.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 0, 0 }, munin::weighted_track(1, 2, 4), { { 0, 0 }, { 4, 1 } }
+                },
+                flex_layout_component_data {
+                    { 0, 0 }, munin::fixed_track(1), { { 4, 0 }, { 1, 1 } }
+                },
+            },
+            { 10, 1 },
+            { 3, 0 }
+        },
+
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 0, 0 }, munin::weighted_track(1, 2), { { 0, 0 }, { 2, 1 } }
+                },
+                flex_layout_component_data {
+                    { 0, 0 }, munin::fixed_track(3), { { 2, 0 }, { 3, 1 } }
+                },
+            },
+            { 5, 1 },
+            { 5, 0 }
+        },
+    }
+));
+
+INSTANTIATE_TEST_SUITE_P(
+    tracks_shrink_when_there_is_not_enough_space,
+    flex_layouts,
+    ValuesIn(
+    {
+        // Preferred tracks shrink first, towards their minimums.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(1), { { 0, 0 }, { 1, 1 } }
+                },
+                flex_layout_component_data {
+                    { 5, 1 }, munin::preferred_track(), { { 1, 0 }, { 3, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::weighted_track(1, 1), { { 4, 0 }, { 1, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(1), { { 5, 0 }, { 1, 1 } }
+                },
+            },
+            { 6, 1 },
+            { 8, 1 }
+        },
+
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 4, 1 }, munin::preferred_track(), { { 0, 0 }, { 2, 1 } }
+                },
+                flex_layout_component_data {
+                    { 4, 1 }, munin::preferred_track(3), { { 2, 0 }, { 3, 1 } }
+                },
+            },
+            { 5, 1 },
+            { 8, 1 }
+        },
+
+        // Then tracks are truncated in the order they were added.
+        flex_layout_test_data {
+            row,
+            {
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(2), { { 0, 0 }, { 2, 1 } }
+                },
+                flex_layout_component_data {
+                    { 4, 1 }, munin::preferred_track(), { { 2, 0 }, { 0, 1 } }
+                },
+                flex_layout_component_data {
+                    { 1, 1 }, munin::fixed_track(2), { { 2, 0 }, { 1, 1 } }
+                },
+            },
+            { 3, 1 },
+            { 8, 1 }
+        },
+    }
+));
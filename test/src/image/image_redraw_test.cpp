@@ -29,7 +29,7 @@ protected :
             [this](auto const &regions)
             {
                 ++redraw_called_;
-                redraw_regions_ = regions;
+                redraw_regions_.assign(regions.begin(), regions.end());
             });
     }
 
@@ -0,0 +1,40 @@
+#include "layout_hint_printer.hpp"
+#include <munin/aligned_layout.hpp>
+#include <munin/compass_layout.hpp>
+#include <munin/layout_hint.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(a_default_layout_hint, is_blank)
+{
+    munin::layout_hint const hint;
+    ASSERT_NE(nullptr, boost::get<boost::blank>(&hint));
+}
+
+TEST(a_layout_hint, holds_a_compass_heading_inline)
+{
+    munin::layout_hint const hint = munin::compass_layout::heading::north;
+
+    auto const *heading = boost::get<munin::compass_heading>(&hint);
+    ASSERT_NE(nullptr, heading);
+    ASSERT_EQ(munin::compass_layout::heading::north, *heading);
+}
+
+TEST(a_layout_hint, holds_an_alignment_inline)
+{
+    munin::layout_hint const hint = munin::alignment_hrvb;
+
+    auto const *align = boost::get<munin::alignment>(&hint);
+    ASSERT_NE(nullptr, align);
+    ASSERT_EQ(munin::horizontal_alignment::right, align->horizontal);
+    ASSERT_EQ(munin::vertical_alignment::bottom, align->vertical);
+}
+
+TEST(a_layout_hint, holds_any_other_value_for_custom_layouts)
+{
+    munin::layout_hint const hint = std::string{"custom"};
+
+    auto const *value = boost::get<boost::any>(&hint);
+    ASSERT_NE(nullptr, value);
+    ASSERT_EQ(std::string{"custom"}, boost::any_cast<std::string>(*value));
+}
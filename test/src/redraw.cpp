@@ -51,3 +51,11 @@ void assert_equivalent_redraw_regions(
     
     ASSERT_EQ(lhs_map, rhs_map);
 }
+
+void assert_equivalent_redraw_regions(
+    std::vector<terminalpp::rectangle> const &lhs,
+    munin::rectangle_list const &rhs)
+{
+    assert_equivalent_redraw_regions(
+        lhs, std::vector<terminalpp::rectangle>(rhs.begin(), rhs.end()));
+}
@@ -0,0 +1,235 @@
+#include <munin/detail/region.hpp>
+#include "redraw.hpp"
+#include <gtest/gtest.h>
+
+using rectangles = std::vector<terminalpp::rectangle>;
+
+TEST(a_new_region, is_empty)
+{
+    munin::detail::region region;
+
+    ASSERT_TRUE(region.empty());
+    ASSERT_EQ(rectangles{}, region.rectangles());
+}
+
+TEST(a_region, ignores_rectangles_with_no_area)
+{
+    munin::detail::region region;
+    region.add({{1, 1}, {0, 5}});
+    region.add({{1, 1}, {5, 0}});
+
+    ASSERT_TRUE(region.empty());
+}
+
+TEST(a_region_with_one_rectangle, contains_only_that_rectangle)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+
+    ASSERT_FALSE(region.empty());
+    ASSERT_EQ((rectangles{{{1, 2}, {3, 4}}}), region.rectangles());
+}
+
+TEST(a_region, can_be_cleared)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+    region.clear();
+
+    ASSERT_TRUE(region.empty());
+}
+
+TEST(a_region, merges_identical_rectangles)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+    region.add({{1, 2}, {3, 4}});
+
+    ASSERT_EQ((rectangles{{{1, 2}, {3, 4}}}), region.rectangles());
+}
+
+TEST(a_region, absorbs_contained_rectangles)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {10, 10}});
+    region.add({{2, 2}, {3, 3}});
+
+    ASSERT_EQ((rectangles{{{0, 0}, {10, 10}}}), region.rectangles());
+}
+
+TEST(a_region, merges_horizontally_adjacent_rectangles)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {2, 3}});
+    region.add({{2, 0}, {2, 3}});
+
+    ASSERT_EQ((rectangles{{{0, 0}, {4, 3}}}), region.rectangles());
+}
+
+TEST(a_region, merges_vertically_adjacent_rectangles)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {5, 1}});
+    region.add({{0, 1}, {5, 1}});
+    region.add({{0, 2}, {5, 1}});
+
+    ASSERT_EQ((rectangles{{{0, 0}, {5, 3}}}), region.rectangles());
+}
+
+TEST(a_region, keeps_separated_rectangles_distinct)
+{
+    munin::detail::region region;
+    region.add({{6, 0}, {2, 2}});
+    region.add({{0, 0}, {2, 2}});
+
+    ASSERT_EQ(
+        (rectangles{{{0, 0}, {2, 2}}, {{6, 0}, {2, 2}}}),
+        region.rectangles());
+}
+
+TEST(a_region, splits_overlapping_rectangles_into_disjoint_bands)
+{
+    //  0123456
+    // 0AAAA
+    // 1AAAA
+    // 2AAXXBB
+    // 3   BBBB
+    munin::detail::region region;
+    region.add({{0, 0}, {4, 3}});
+    region.add({{2, 2}, {4, 2}});
+
+    auto const expected = rectangles{
+        {{0, 0}, {4, 2}},
+        {{0, 2}, {6, 1}},
+        {{2, 3}, {4, 1}},
+    };
+
+    ASSERT_EQ(expected, region.rectangles());
+}
+
+TEST(a_region, bridges_gaps_between_rectangles)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {2, 1}});
+    region.add({{4, 0}, {2, 1}});
+    region.add({{1, 0}, {4, 1}});
+
+    ASSERT_EQ((rectangles{{{0, 0}, {6, 1}}}), region.rectangles());
+}
+
+TEST(a_region, covers_exactly_the_cells_of_its_rectangles)
+{
+    auto const added = rectangles{
+        {{0, 0}, {5, 5}},
+        {{3, 3}, {5, 5}},
+        {{1, 7}, {2, 2}},
+        {{2, 1}, {1, 8}},
+        {{6, 0}, {1, 1}},
+    };
+
+    munin::detail::region region;
+
+    for (auto const &rect : added)
+    {
+        region.add(rect);
+    }
+
+    auto const result = region.rectangles();
+    assert_equivalent_redraw_regions(added, result);
+
+    // Check that no cell is covered twice.
+    for (auto lhs = result.begin(); lhs != result.end(); ++lhs)
+    {
+        for (auto rhs = lhs + 1; rhs != result.end(); ++rhs)
+        {
+            bool const overlaps =
+                lhs->origin.x < rhs->origin.x + rhs->size.width
+             && rhs->origin.x < lhs->origin.x + lhs->size.width
+             && lhs->origin.y < rhs->origin.y + rhs->size.height
+             && rhs->origin.y < lhs->origin.y + lhs->size.height;
+
+            ASSERT_FALSE(overlaps);
+        }
+    }
+}
+
+TEST(a_region, is_emptied_by_subtracting_a_covering_rectangle)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+    region.subtract({{0, 0}, {10, 10}});
+
+    ASSERT_TRUE(region.empty());
+}
+
+TEST(a_region, is_unchanged_by_subtracting_a_disjoint_rectangle)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+    region.subtract({{5, 5}, {2, 2}});
+
+    ASSERT_EQ((rectangles{{{1, 2}, {3, 4}}}), region.rectangles());
+}
+
+TEST(a_region, ignores_subtracted_rectangles_with_no_area)
+{
+    munin::detail::region region;
+    region.add({{1, 2}, {3, 4}});
+    region.subtract({{1, 2}, {0, 4}});
+
+    ASSERT_EQ((rectangles{{{1, 2}, {3, 4}}}), region.rectangles());
+}
+
+TEST(a_region, has_a_hole_after_subtracting_a_contained_rectangle)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {5, 5}});
+    region.subtract({{1, 1}, {3, 3}});
+
+    auto const expected = rectangles{
+        {{0, 0}, {5, 1}},
+        {{0, 1}, {1, 3}},
+        {{4, 1}, {1, 3}},
+        {{0, 4}, {5, 1}},
+    };
+
+    ASSERT_EQ(expected, region.rectangles());
+}
+
+TEST(a_region, keeps_the_uncovered_part_after_subtracting_an_overlapping_rectangle)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {4, 4}});
+    region.subtract({{2, 2}, {4, 4}});
+
+    auto const expected = rectangles{
+        {{0, 0}, {4, 2}},
+        {{0, 2}, {2, 2}},
+    };
+
+    ASSERT_EQ(expected, region.rectangles());
+}
+
+TEST(a_region, keeps_cells_that_a_scroll_moves_and_those_that_it_leaves)
+{
+    munin::detail::region region;
+    region.add({{0, 5}, {10, 1}});
+
+    region.scroll({{0, 2}, {10, 6}}, 2);
+
+    ASSERT_EQ(
+        (rectangles{{{0, 3}, {10, 1}}, {{0, 5}, {10, 1}}}), 
+        region.rectangles());
+}
+
+TEST(a_region, drops_cells_that_a_scroll_moves_out_of_its_area)
+{
+    munin::detail::region region;
+    region.add({{0, 0}, {4, 2}});
+
+    region.scroll({{0, 1}, {4, 4}}, -3);
+
+    ASSERT_EQ(
+        (rectangles{{{0, 0}, {4, 2}}, {{0, 4}, {4, 1}}}), 
+        region.rectangles());
+}
@@ -1,4 +1,5 @@
 #include <munin/render_surface.hpp>
+#include <terminalpp/string.hpp>
 #include <gtest/gtest.h>
 
 TEST(render_surface_test, default_render_surface_views_same_basis_as_canvas)
@@ -62,3 +63,160 @@ TEST(render_surface_test, offset_is_cumulative)
     render_surface[0][0] = 'x';
     ASSERT_TRUE(canvas[2][2] == 'x');
 }
+
+TEST(render_surface_test, fill_row_sets_a_run_of_elements_relative_to_the_offset)
+{
+    terminalpp::canvas canvas({4, 3});
+    munin::render_surface render_surface(canvas);
+
+    render_surface.offset_by({1, 1});
+    render_surface.fill_row({1, 0}, 2, 'x');
+
+    for (auto row = 0; row < 3; ++row)
+    {
+        for (auto column = 0; column < 4; ++column)
+        {
+            bool const filled = row == 1 && column >= 2;
+            ASSERT_EQ(terminalpp::element(filled ? 'x' : ' '), canvas[column][row]);
+        }
+    }
+}
+
+TEST(render_surface_test, write_row_copies_a_sequence_of_elements_relative_to_the_offset)
+{
+    using namespace terminalpp::literals;
+
+    terminalpp::canvas canvas({4, 2});
+    munin::render_surface render_surface(canvas);
+    auto const text = "abc"_ts;
+
+    render_surface.offset_by({1, 1});
+    render_surface.write_row({0, 0}, text.begin(), text.end());
+
+    ASSERT_EQ(terminalpp::element(' '), canvas[0][1]);
+    ASSERT_EQ(terminalpp::element('a'), canvas[1][1]);
+    ASSERT_EQ(terminalpp::element('b'), canvas[2][1]);
+    ASSERT_EQ(terminalpp::element('c'), canvas[3][1]);
+    ASSERT_EQ(terminalpp::element(' '), canvas[1][0]);
+}
+
+TEST(render_surface_test, fill_rect_sets_every_element_in_the_region)
+{
+    terminalpp::canvas canvas({4, 4});
+    munin::render_surface render_surface(canvas);
+
+    render_surface.offset_by({1, 0});
+    render_surface.fill_rect({{0, 1}, {2, 2}}, 'x');
+
+    for (auto row = 0; row < 4; ++row)
+    {
+        for (auto column = 0; column < 4; ++column)
+        {
+            bool const filled = 
+                row >= 1 && row < 3 && column >= 1 && column < 3;
+            ASSERT_EQ(terminalpp::element(filled ? 'x' : ' '), canvas[column][row]);
+        }
+    }
+}
+
+TEST(render_surface_test, has_a_clip_region_of_the_whole_canvas_by_default)
+{
+    terminalpp::canvas canvas({4, 3});
+    munin::render_surface render_surface(canvas);
+
+    ASSERT_EQ(terminalpp::rectangle({0, 0}, {4, 3}), render_surface.clip_region());
+}
+
+TEST(render_surface_test, scoped_clip_moves_the_basis_and_restricts_the_clip_region)
+{
+    terminalpp::canvas canvas({5, 5});
+    munin::render_surface render_surface(canvas);
+
+    {
+        munin::render_surface::scoped_clip clip(render_surface, {{1, 1}, {2, 2}});
+
+        ASSERT_EQ(terminalpp::rectangle({0, 0}, {2, 2}), render_surface.clip_region());
+
+        render_surface[0][0] = 'a';
+        render_surface[2][0] = 'b';
+        render_surface[0][2] = 'c';
+        render_surface.fill_row({-1, 1}, 5, 'd');
+        render_surface.fill_rect({{-1, -1}, {1, 5}}, 'e');
+    }
+
+    ASSERT_EQ(terminalpp::rectangle({0, 0}, {5, 5}), render_surface.clip_region());
+
+    render_surface[4][4] = 'f';
+
+    for (auto row = 0; row < 5; ++row)
+    {
+        for (auto column = 0; column < 5; ++column)
+        {
+            auto const expected =
+                row == 1 && column == 1 ? 'a'
+              : row == 2 && column >= 1 && column < 3 ? 'd'
+              : row == 4 && column == 4 ? 'f'
+              : ' ';
+
+            ASSERT_EQ(terminalpp::element(expected), canvas[column][row]);
+        }
+    }
+}
+
+TEST(render_surface_test, nested_scoped_clips_intersect)
+{
+    using namespace terminalpp::literals;
+
+    terminalpp::canvas canvas({6, 3});
+    munin::render_surface render_surface(canvas);
+    auto const text = "abcdef"_ts;
+
+    munin::render_surface::scoped_clip outer(render_surface, {{1, 0}, {3, 3}});
+    munin::render_surface::scoped_clip inner(render_surface, {{-1, 1}, {6, 1}});
+
+    ASSERT_EQ(terminalpp::rectangle({1, 0}, {3, 1}), render_surface.clip_region());
+
+    render_surface.write_row({0, 0}, text.begin(), text.end());
+
+    ASSERT_EQ(terminalpp::element(' '), canvas[0][1]);
+    ASSERT_EQ(terminalpp::element('b'), canvas[1][1]);
+    ASSERT_EQ(terminalpp::element('c'), canvas[2][1]);
+    ASSERT_EQ(terminalpp::element('d'), canvas[3][1]);
+    ASSERT_EQ(terminalpp::element(' '), canvas[4][1]);
+}
+
+TEST(render_surface_test, does_not_track_changes_by_default)
+{
+    terminalpp::canvas canvas({4, 3});
+    munin::render_surface render_surface(canvas);
+
+    render_surface.fill_row({0, 0}, 4, 'x');
+
+    ASSERT_TRUE(render_surface.changed_regions().empty());
+}
+
+TEST(render_surface_test, when_tracking_changes_records_only_elements_that_changed)
+{
+    using namespace terminalpp::literals;
+
+    terminalpp::canvas canvas({6, 4});
+    munin::render_surface render_surface(canvas);
+    auto const text = "a bc"_ts;
+
+    render_surface.track_changes();
+    render_surface.offset_by({1, 0});
+
+    // Writing the same value as is already there is not a change.
+    render_surface.fill_rect({{0, 0}, {5, 4}}, ' ');
+    render_surface.write_row({0, 1}, text.begin(), text.end());
+    render_surface.fill_row({1, 2}, 2, 'x');
+    render_surface[4][3];
+
+    auto const expected = std::vector<terminalpp::rectangle>{
+        {{1, 1}, {4, 1}},
+        {{2, 2}, {2, 1}},
+        {{5, 3}, {1, 1}}
+    };
+
+    ASSERT_EQ(expected, render_surface.changed_regions());
+}
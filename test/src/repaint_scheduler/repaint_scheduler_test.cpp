@@ -0,0 +1,234 @@
+#include "mock/component.hpp"
+#include <munin/repaint_scheduler.hpp>
+#include <munin/window.hpp>
+#include <terminalpp/canvas.hpp>
+#include <terminalpp/terminal.hpp>
+#include <gtest/gtest.h>
+
+using namespace std::literals;
+using testing::Return;
+using testing::_;
+
+class a_repaint_scheduler : public testing::Test
+{
+protected :
+    using time_point = munin::repaint_scheduler::time_point;
+
+    a_repaint_scheduler()
+    {
+        ON_CALL(*content_, do_get_size())
+            .WillByDefault(Return(terminalpp::extent{10, 10}));
+
+        scheduler_.add_window(window_, [this]{ paint(); });
+    }
+
+    void paint()
+    {
+        ++paint_count_;
+        window_.repaint(canvas_, terminal_);
+    }
+
+    void request_repaint()
+    {
+        content_->on_redraw({{{}, {1, 1}}});
+    }
+
+    time_point now_ = time_point{} + 1h;
+    munin::repaint_scheduler scheduler_{100ms, [this]{ return now_; }};
+
+    std::shared_ptr<mock_component> content_ = 
+        std::make_shared<testing::NiceMock<mock_component>>();
+    munin::window window_{content_};
+    terminalpp::canvas canvas_{{10, 10}};
+    terminalpp::terminal terminal_;
+    int paint_count_ = 0;
+};
+
+TEST_F(a_repaint_scheduler, with_no_requests_has_no_deadline)
+{
+    ASSERT_FALSE(scheduler_.next_deadline().is_initialized());
+
+    scheduler_.poll();
+    ASSERT_EQ(0, paint_count_);
+}
+
+TEST_F(a_repaint_scheduler, paints_a_newly_requesting_window_immediately)
+{
+    boost::optional<time_point> scheduled;
+    scheduler_.on_repaint_scheduled.connect(
+        [&](auto deadline)
+        {
+            scheduled = deadline;
+        });
+
+    request_repaint();
+
+    ASSERT_EQ(now_, *scheduled);
+    ASSERT_EQ(now_, *scheduler_.next_deadline());
+
+    scheduler_.poll();
+    ASSERT_EQ(1, paint_count_);
+    ASSERT_FALSE(scheduler_.next_deadline().is_initialized());
+}
+
+TEST_F(a_repaint_scheduler, schedules_a_window_that_requested_a_repaint_before_it_was_added)
+{
+    scheduler_.remove_window(window_);
+    request_repaint();
+
+    boost::optional<time_point> scheduled;
+    scheduler_.on_repaint_scheduled.connect(
+        [&](auto deadline)
+        {
+            scheduled = deadline;
+        });
+
+    scheduler_.add_window(window_, [this]{ paint(); });
+
+    ASSERT_EQ(now_, *scheduled);
+    ASSERT_EQ(now_, *scheduler_.next_deadline());
+
+    scheduler_.poll();
+    ASSERT_EQ(1, paint_count_);
+    ASSERT_FALSE(window_.repaint_requested());
+}
+
+TEST_F(a_repaint_scheduler, folds_many_requests_into_one_paint)
+{
+    int scheduled_count = 0;
+    scheduler_.on_repaint_scheduled.connect(
+        [&](auto)
+        {
+            ++scheduled_count;
+        });
+
+    request_repaint();
+    request_repaint();
+    request_repaint();
+    
+    scheduler_.poll();
+    scheduler_.poll();
+    
+    ASSERT_EQ(1, scheduled_count);
+    ASSERT_EQ(1, paint_count_);
+}
+
+TEST_F(a_repaint_scheduler, delays_a_paint_until_the_frame_interval_has_passed)
+{
+    request_repaint();
+    scheduler_.poll();
+    ASSERT_EQ(1, paint_count_);
+
+    auto const last_paint = now_;
+    now_ += 30ms;
+
+    request_repaint();
+    request_repaint();
+    ASSERT_EQ(last_paint + 100ms, *scheduler_.next_deadline());
+
+    scheduler_.poll();
+    ASSERT_EQ(1, paint_count_);
+
+    now_ = last_paint + 100ms;
+    scheduler_.poll();
+    ASSERT_EQ(2, paint_count_);
+}
+
+TEST_F(a_repaint_scheduler, paints_immediately_after_an_idle_frame_interval)
+{
+    request_repaint();
+    scheduler_.poll();
+
+    now_ += 250ms;
+    request_repaint();
+    
+    ASSERT_EQ(now_, *scheduler_.next_deadline());
+    
+    scheduler_.poll();
+    ASSERT_EQ(2, paint_count_);
+}
+
+TEST_F(a_repaint_scheduler, schedules_each_window_independently)
+{
+    auto const other_content = 
+        std::make_shared<testing::NiceMock<mock_component>>();
+    ON_CALL(*other_content, do_get_size())
+        .WillByDefault(Return(terminalpp::extent{10, 10}));
+
+    munin::window other_window{other_content};
+    terminalpp::canvas other_canvas{{10, 10}};
+    terminalpp::terminal other_terminal;
+    int other_paint_count = 0;
+    
+    scheduler_.add_window(
+        other_window,
+        [&]
+        {
+            ++other_paint_count;
+            other_window.repaint(other_canvas, other_terminal);
+        });
+
+    request_repaint();
+    scheduler_.poll();
+    
+    now_ += 50ms;
+    request_repaint();
+    other_content->on_redraw({{{}, {1, 1}}});
+    scheduler_.poll();
+
+    ASSERT_EQ(1, paint_count_);
+    ASSERT_EQ(1, other_paint_count);
+
+    scheduler_.remove_window(other_window);
+}
+
+TEST_F(a_repaint_scheduler, discards_requests_from_removed_windows)
+{
+    request_repaint();
+    scheduler_.remove_window(window_);
+
+    ASSERT_FALSE(scheduler_.next_deadline().is_initialized());
+
+    request_repaint();
+    scheduler_.poll();
+    ASSERT_EQ(0, paint_count_);
+}
+
+TEST_F(a_repaint_scheduler, does_not_paint_a_window_removed_by_an_earlier_paint)
+{
+    auto const other_content = 
+        std::make_shared<testing::NiceMock<mock_component>>();
+    ON_CALL(*other_content, do_get_size())
+        .WillByDefault(Return(terminalpp::extent{10, 10}));
+
+    auto other_window = 
+        std::unique_ptr<munin::window>(new munin::window{other_content});
+    int other_paint_count = 0;
+
+    // When this window is painted, it removes and destroys the other 
+    // window, whose paint is also due.
+    scheduler_.remove_window(window_);
+    scheduler_.add_window(
+        window_,
+        [&]
+        {
+            paint();
+            scheduler_.remove_window(*other_window);
+            other_window.reset();
+        });
+
+    scheduler_.add_window(
+        *other_window,
+        [&]
+        {
+            ++other_paint_count;
+        });
+
+    request_repaint();
+    other_content->on_redraw({{{}, {1, 1}}});
+    scheduler_.poll();
+
+    ASSERT_EQ(1, paint_count_);
+    ASSERT_EQ(0, other_paint_count);
+    ASSERT_FALSE(scheduler_.next_deadline().is_initialized());
+}
@@ -0,0 +1,69 @@
+#include <munin/scrollback.hpp>
+#include <munin/render_surface.hpp>
+#include <terminalpp/canvas.hpp>
+#include <terminalpp/string.hpp>
+#include <gtest/gtest.h>
+
+using namespace terminalpp::literals;
+
+TEST(a_new_scrollback, has_a_content_extent_of_its_text)
+{
+    munin::scrollback scrollback;
+    scrollback.insert_text("abc\nd"_ts);
+
+    ASSERT_EQ(terminalpp::extent(3, 2), scrollback.get_content_extent());
+}
+
+TEST(a_scrollback_with_text_inserted, has_a_content_extent_of_its_width_and_laid_out_rows)
+{
+    munin::scrollback scrollback;
+    scrollback.insert_text("ab"_ts);
+    scrollback.set_size({4, 2});
+    scrollback.insert_text("\ncdefg"_ts);
+
+    ASSERT_EQ(terminalpp::extent(4, 3), scrollback.get_content_extent());
+
+    scrollback.set_size({3, 2});
+    ASSERT_EQ(terminalpp::extent(3, 3), scrollback.get_content_extent());
+}
+
+TEST(a_scrollback_with_text_inserted, draws_rows_wrapped_at_its_width)
+{
+    munin::scrollback scrollback;
+    scrollback.set_size({3, 3});
+    scrollback.insert_text("abcd\nef"_ts);
+
+    terminalpp::canvas cvs{{3, 3}};
+    munin::render_surface surface{cvs};
+    scrollback.draw(surface, {{}, scrollback.get_size()});
+
+    ASSERT_EQ(terminalpp::element{'a'}, cvs[0][0]);
+    ASSERT_EQ(terminalpp::element{'b'}, cvs[1][0]);
+    ASSERT_EQ(terminalpp::element{'c'}, cvs[2][0]);
+    ASSERT_EQ(terminalpp::element{'d'}, cvs[0][1]);
+    ASSERT_EQ(terminalpp::element{' '}, cvs[1][1]);
+    ASSERT_EQ(terminalpp::element{'e'}, cvs[0][2]);
+    ASSERT_EQ(terminalpp::element{'f'}, cvs[1][2]);
+    ASSERT_EQ(terminalpp::element{' '}, cvs[2][2]);
+}
+
+TEST(a_scrollback_with_text_inserted, announces_a_preferred_size_change_when_its_width_changes)
+{
+    munin::scrollback scrollback;
+    scrollback.set_size({3, 2});
+    scrollback.insert_text("abcd"_ts);
+
+    int preferred_size_changed_count = 0;
+    scrollback.on_preferred_size_changed.connect(
+        [&preferred_size_changed_count]
+        {
+            ++preferred_size_changed_count;
+        });
+
+    scrollback.set_size({3, 3});
+    ASSERT_EQ(0, preferred_size_changed_count);
+
+    scrollback.set_size({4, 3});
+    ASSERT_EQ(1, preferred_size_changed_count);
+    ASSERT_EQ(terminalpp::extent(4, 2), scrollback.get_content_extent());
+}
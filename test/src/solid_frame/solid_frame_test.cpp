@@ -188,7 +188,7 @@ TEST_F(a_solid_frame_with_an_associated_unfocussed_component, redraws_when_assoc
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -216,7 +216,7 @@ TEST_F(a_solid_frame_with_an_associated_unfocussed_component, redraws_a_reduced_
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -307,7 +307,7 @@ TEST_F(a_solid_frame_with_an_associated_focussed_component, redraws_when_associa
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
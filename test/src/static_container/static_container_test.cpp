@@ -0,0 +1,253 @@
+#include <munin/static_container.hpp>
+#include <munin/static_flex_layout.hpp>
+#include <munin/edit.hpp>
+#include <munin/filled_box.hpp>
+#include <munin/render_surface.hpp>
+#include <terminalpp/ansi/mouse.hpp>
+#include <terminalpp/canvas.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+using column_layout = munin::static_flex_layout<
+    munin::flex_direction::column, 3>;
+
+using status_container = munin::static_container<
+    column_layout,
+    munin::filled_box,
+    munin::filled_box,
+    munin::filled_box>;
+
+class a_static_container : public testing::Test
+{
+protected :
+    a_static_container()
+      : container_(
+            munin::make_static_flex_layout<munin::flex_direction::column>(
+                munin::fixed_track(1),
+                munin::weighted_track(),
+                munin::fixed_track(1)),
+            terminalpp::element('t'),
+            terminalpp::element('m'),
+            terminalpp::element('b'))
+    {
+        container_.on_redraw.connect(
+            [this](munin::rectangle_list const &regions)
+            {
+                redraw_regions_.assign(regions.begin(), regions.end());
+            });
+    }
+
+    status_container container_;
+    std::vector<terminalpp::rectangle> redraw_regions_;
+};
+
+}
+
+TEST_F(a_static_container, lays_out_its_components_when_sized)
+{
+    container_.set_size({4, 5});
+
+    ASSERT_EQ(terminalpp::point(0, 0), container_.get<0>().get_position());
+    ASSERT_EQ(terminalpp::extent(4, 1), container_.get<0>().get_size());
+    ASSERT_EQ(terminalpp::point(0, 1), container_.get<1>().get_position());
+    ASSERT_EQ(terminalpp::extent(4, 3), container_.get<1>().get_size());
+    ASSERT_EQ(terminalpp::point(0, 4), container_.get<2>().get_position());
+    ASSERT_EQ(terminalpp::extent(4, 1), container_.get<2>().get_size());
+
+    auto const expected_regions = std::vector<terminalpp::rectangle>{
+        {{0, 0}, {4, 5}}
+    };
+
+    ASSERT_EQ(expected_regions, redraw_regions_);
+}
+
+TEST_F(a_static_container, has_the_preferred_size_of_its_layout)
+{
+    container_.get<1>().set_preferred_size({3, 2});
+
+    ASSERT_EQ(terminalpp::extent(3, 4), container_.get_preferred_size());
+}
+
+TEST_F(a_static_container, relays_out_when_a_preferred_size_changes)
+{
+    int preferred_size_changed_count = 0;
+    container_.on_preferred_size_changed.connect(
+        [&preferred_size_changed_count]
+        {
+            ++preferred_size_changed_count;
+        });
+
+    container_.set_size({4, 5});
+    container_.get<1>().set_preferred_size({2, 2});
+
+    ASSERT_EQ(1, preferred_size_changed_count);
+    ASSERT_EQ(terminalpp::extent(4, 3), container_.get<1>().get_size());
+}
+
+TEST_F(a_static_container, redraws_nothing_when_a_preferred_size_change_moves_nothing)
+{
+    container_.set_size({4, 5});
+    redraw_regions_.clear();
+
+    container_.get<1>().set_preferred_size({2, 2});
+
+    terminalpp::canvas canvas({4, 5});
+    munin::render_surface surface{canvas};
+    container_.draw(surface, {{}, {4, 5}});
+
+    ASSERT_TRUE(redraw_regions_.empty());
+}
+
+TEST_F(a_static_container, draws_each_component_in_its_place)
+{
+    container_.set_size({2, 3});
+
+    terminalpp::canvas canvas({2, 3});
+    munin::render_surface surface{canvas};
+
+    container_.draw(surface, {{}, {2, 3}});
+
+    ASSERT_EQ(terminalpp::element('t'), canvas[0][0]);
+    ASSERT_EQ(terminalpp::element('t'), canvas[1][0]);
+    ASSERT_EQ(terminalpp::element('m'), canvas[0][1]);
+    ASSERT_EQ(terminalpp::element('m'), canvas[1][1]);
+    ASSERT_EQ(terminalpp::element('b'), canvas[0][2]);
+    ASSERT_EQ(terminalpp::element('b'), canvas[1][2]);
+}
+
+TEST_F(a_static_container, translates_redraw_regions_of_its_components)
+{
+    container_.set_size({4, 5});
+    redraw_regions_.clear();
+
+    container_.get<1>().on_redraw({{{1, 1}, {2, 1}}});
+
+    auto const expected_regions = std::vector<terminalpp::rectangle>{
+        {{1, 2}, {2, 1}}
+    };
+
+    ASSERT_EQ(expected_regions, redraw_regions_);
+}
+
+TEST_F(a_static_container, clips_redraw_regions_to_its_components)
+{
+    container_.set_size({4, 5});
+    redraw_regions_.clear();
+
+    container_.get<2>().on_redraw({{{0, 0}, {10, 10}}});
+
+    auto const expected_regions = std::vector<terminalpp::rectangle>{
+        {{0, 4}, {4, 1}}
+    };
+
+    ASSERT_EQ(expected_regions, redraw_regions_);
+}
+
+namespace {
+
+using prompt_container = munin::static_container<
+    column_layout,
+    munin::filled_box,
+    munin::edit,
+    munin::edit>;
+
+class a_static_container_with_focussable_components : public testing::Test
+{
+protected :
+    a_static_container_with_focussable_components()
+      : container_(
+            munin::make_static_flex_layout<munin::flex_direction::column>(
+                munin::fixed_track(1),
+                munin::fixed_track(1),
+                munin::weighted_track()))
+    {
+        container_.set_size({4, 5});
+    }
+
+    prompt_container container_;
+};
+
+}
+
+TEST_F(a_static_container_with_focussable_components, 
+       gives_focus_to_its_first_focussable_component)
+{
+    int focus_set_count = 0;
+    container_.on_focus_set.connect(
+        [&focus_set_count]
+        {
+            ++focus_set_count;
+        });
+
+    container_.set_focus();
+
+    ASSERT_TRUE(container_.has_focus());
+    ASSERT_TRUE(container_.get<1>().has_focus());
+    ASSERT_FALSE(container_.get<2>().has_focus());
+    ASSERT_EQ(1, focus_set_count);
+}
+
+TEST_F(a_static_container_with_focussable_components, 
+       moves_focus_between_its_components)
+{
+    container_.set_focus();
+
+    container_.focus_next();
+    ASSERT_FALSE(container_.get<1>().has_focus());
+    ASSERT_TRUE(container_.get<2>().has_focus());
+
+    container_.focus_previous();
+    ASSERT_TRUE(container_.get<1>().has_focus());
+    ASSERT_FALSE(container_.get<2>().has_focus());
+
+    container_.focus_previous();
+    ASSERT_FALSE(container_.has_focus());
+}
+
+TEST_F(a_static_container_with_focussable_components, 
+       tracks_focus_set_directly_on_a_component)
+{
+    container_.set_focus();
+    container_.get<2>().set_focus();
+
+    ASSERT_TRUE(container_.has_focus());
+    ASSERT_FALSE(container_.get<1>().has_focus());
+    ASSERT_TRUE(container_.get<2>().has_focus());
+
+    container_.get<2>().lose_focus();
+
+    ASSERT_FALSE(container_.has_focus());
+}
+
+TEST_F(a_static_container_with_focussable_components, 
+       reports_the_cursor_of_the_focussed_component)
+{
+    container_.get<2>().set_focus();
+
+    ASSERT_TRUE(container_.get_cursor_state());
+    ASSERT_EQ(terminalpp::point(0, 2), container_.get_cursor_position());
+}
+
+TEST_F(a_static_container_with_focussable_components, 
+       passes_mouse_events_to_the_component_at_their_location)
+{
+    container_.event(terminalpp::ansi::mouse::report{
+        terminalpp::ansi::mouse::report::LEFT_BUTTON_DOWN, 1, 3});
+
+    ASSERT_FALSE(container_.get<1>().has_focus());
+    ASSERT_TRUE(container_.get<2>().has_focus());
+    ASSERT_TRUE(container_.has_focus());
+}
+
+TEST_F(a_static_container, reports_attributes_as_json)
+{
+    container_.set_size({4, 5});
+
+    nlohmann::json json = container_.to_json();
+
+    ASSERT_EQ("static_container", json["type"]);
+    ASSERT_EQ("static_flex_layout", json["layout"]["type"]);
+    ASSERT_EQ("column", json["layout"]["direction"]);
+    ASSERT_EQ(3u, json["subcomponents"].size());
+}
@@ -93,7 +93,7 @@ TEST_F(a_new_text_area, requests_a_redraw_and_draws_inserted_text_when_text_is_i
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     text_area_.insert_text("b"_ts);
@@ -127,7 +127,7 @@ TEST_F(a_new_text_area, flows_long_text_into_the_next_line)
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     text_area_.insert_text("cde"_ts);
@@ -161,7 +161,7 @@ TEST_F(a_new_text_area, flows_newlines_when_drawing_text)
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     text_area_.insert_text("c\nde"_ts);
@@ -288,7 +288,7 @@ TEST_F(a_new_text_area, does_not_move_the_caret_when_inserting_at_a_specified_in
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
 
     text_area_.insert_text("a"_ts, 0);
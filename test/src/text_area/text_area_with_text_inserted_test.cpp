@@ -21,7 +21,7 @@ TEST_F(a_text_area_with_text_inserted, can_have_text_inserted_at_the_front)
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
 
     text_area_.insert_text("c", 0);
@@ -52,7 +52,7 @@ TEST_F(a_text_area_with_text_inserted, can_have_text_inserted_in_the_middle)
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
 
     text_area_.insert_text("c", 1);
@@ -83,7 +83,7 @@ TEST_F(a_text_area_with_text_inserted, can_have_text_inserted_that_pushes_existi
         [&](auto const &regions)
         {
             redraw_requested = true;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
 
     text_area_.insert_text("defg", 1);
@@ -146,6 +146,29 @@ TEST_F(a_titled_frame_with_no_unicode_support, clips_the_title_when_shrunk)
     ASSERT_EQ(bottom_right_corner, canvas[8][2]);
 }
 
+TEST_F(a_titled_frame_with_no_unicode_support, keeps_its_corners_when_narrower_than_its_title)
+{
+    auto const size = terminalpp::extent{4, 3};
+    frame_.set_size(size);
+    
+    terminalpp::canvas canvas(size);
+    munin::render_surface surface{canvas, surface_capabilities_};
+    frame_.draw(surface, {{}, size});
+
+    ASSERT_EQ(top_left_corner,     canvas[0][0]);
+    ASSERT_EQ(horizontal_beam,     canvas[1][0]);
+    ASSERT_EQ(' ',                 canvas[2][0]);
+    ASSERT_EQ(top_right_corner,    canvas[3][0]);
+
+    ASSERT_EQ(vertical_beam,       canvas[0][1]);
+    ASSERT_EQ(vertical_beam,       canvas[3][1]);
+    
+    ASSERT_EQ(bottom_left_corner,  canvas[0][2]);
+    ASSERT_EQ(horizontal_beam,     canvas[1][2]);
+    ASSERT_EQ(horizontal_beam,     canvas[2][2]);
+    ASSERT_EQ(bottom_right_corner, canvas[3][2]);
+}
+
 TEST_F(a_titled_frame_with_unicode_support, draws_a_border_with_box_drawing_glyphs)
 {
     auto const size = terminalpp::extent{11, 3};
@@ -341,7 +364,7 @@ TEST_F(a_titled_frame_with_an_associated_unfocussed_component, redraws_when_asso
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -370,7 +393,7 @@ TEST_F(a_titled_frame_with_an_associated_unfocussed_component, redraws_a_reduced
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -405,7 +428,7 @@ TEST_F(a_titled_frame_with_an_associated_unfocussed_component, redraws_a_reduced
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -439,7 +462,7 @@ TEST_F(a_titled_frame_with_an_associated_unfocussed_component, redraws_a_reduced
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -468,7 +491,7 @@ TEST_F(a_titled_frame_with_an_associated_unfocussed_component, redraws_a_reduced
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
@@ -584,7 +607,7 @@ TEST_F(a_titled_frame_with_an_associated_focussed_component, redraws_when_associ
         [&redraw_count, &redraw_regions](auto const &regions)
         {
             ++redraw_count;
-            redraw_regions = regions;
+            redraw_regions.assign(regions.begin(), regions.end());
         });
     
     ON_CALL(*comp_, do_has_focus())
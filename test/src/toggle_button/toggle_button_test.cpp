@@ -138,7 +138,7 @@ TEST(setting_the_toggle_state_of_a_toggle_button, fires_a_redraw_request)
 
     std::vector<terminalpp::rectangle> redraw_regions;
     button->on_redraw.connect(
-        [&redraw_regions](std::vector<terminalpp::rectangle> const &regions)
+        [&redraw_regions](munin::rectangle_list const &regions)
         {
             redraw_regions.insert(
                 redraw_regions.end(),
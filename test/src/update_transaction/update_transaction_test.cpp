@@ -0,0 +1,72 @@
+#include <munin/edit.hpp>
+#include <munin/text_area.hpp>
+#include <munin/update_transaction.hpp>
+#include <munin/view.hpp>
+#include <munin/vertical_strip_layout.hpp>
+#include <munin/viewport.hpp>
+#include <munin/window.hpp>
+#include <terminalpp/virtual_key.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace terminalpp::literals;
+
+TEST(sending_many_events_to_a_window, announces_one_redraw_from_its_content)
+{
+    auto const edit = munin::make_edit();
+    auto const content = munin::view(
+        munin::make_vertical_strip_layout(),
+        edit);
+    content->set_size({10, 1});
+    content->set_focus();
+
+    munin::window window{content};
+
+    int redraw_count = 0;
+    content->on_redraw.connect(
+        [&redraw_count](auto const &)
+        {
+            ++redraw_count;
+        });
+
+    int cursor_position_changed_count = 0;
+    content->on_cursor_position_changed.connect(
+        [&cursor_position_changed_count]
+        {
+            ++cursor_position_changed_count;
+        });
+
+    auto const keypress = 
+        terminalpp::virtual_key{terminalpp::vk::lowercase_t};
+    window.events(std::vector<boost::any>(5, keypress));
+
+    ASSERT_EQ(1, redraw_count);
+    ASSERT_EQ(1, cursor_position_changed_count);
+    ASSERT_EQ(terminalpp::point(5, 0), content->get_cursor_position());
+}
+
+TEST(a_viewport_during_a_transaction, defers_tracking_its_component)
+{
+    auto const text_area = munin::make_text_area();
+    auto const viewport = munin::make_viewport(text_area);
+    viewport->set_size({5, 2});
+
+    int preferred_size_changed_count = 0;
+    viewport->on_preferred_size_changed.connect(
+        [&preferred_size_changed_count]
+        {
+            ++preferred_size_changed_count;
+        });
+
+    {
+        munin::update_transaction transaction;
+
+        text_area->insert_text("a\nb\nc\n"_ts);
+        text_area->insert_text("d\ne\nf\n"_ts);
+
+        ASSERT_EQ(0, preferred_size_changed_count);
+    }
+
+    ASSERT_EQ(1, preferred_size_changed_count);
+    ASSERT_EQ(terminalpp::point(0, 1), viewport->get_cursor_position());
+}
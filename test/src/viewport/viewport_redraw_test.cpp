@@ -1,5 +1,6 @@
 #include "viewport_test.hpp"
 #include <tuple>
+#include <vector>
 
 using testing::ValuesIn;
 
@@ -38,7 +39,7 @@ TEST_P(viewport_cursor_movement_redraw_test, cursor_movements)
     // a redraw occurred.
     boost::optional<terminalpp::rectangle> redraw_region;
     viewport_->on_redraw.connect(
-        [&](std::vector<terminalpp::rectangle> const &regions)
+        [&](munin::rectangle_list const &regions)
         {
             ASSERT_EQ(1u, regions.size());
             redraw_region = regions[0];
@@ -94,3 +95,119 @@ INSTANTIATE_TEST_SUITE_P(
     })
 );
 
+
+namespace {
+
+using cursor_movement_scroll_test_data = std::tuple<
+    std::vector<terminalpp::point>,           // initial cursor movements
+    terminalpp::point,                        // cursor movement whose scroll
+                                              // we want to track
+    boost::optional<terminalpp::coordinate_type>, // expected scrolled rows
+    boost::optional<terminalpp::rectangle>    // expected redraw region
+>;
+
+class viewport_cursor_movement_scroll_test
+  : public viewport_mock_test_with_data<cursor_movement_scroll_test_data>
+{
+};
+
+}
+
+TEST_P(viewport_cursor_movement_scroll_test, cursor_movements)
+{
+    using std::get;
+
+    auto const &param = GetParam();
+    auto const &initial_cursor_movements = get<0>(param);
+    auto const &cursor_movement = get<1>(param);
+    auto const &expected_scrolled_rows = get<2>(param);
+    auto const &expected_redraw_region = get<3>(param);
+
+    for (auto const &position : initial_cursor_movements)
+    {
+        tracked_component_->set_cursor_position(position);
+    }
+
+    // Accept any scroll that the viewport offers, as a window would.
+    boost::optional<terminalpp::coordinate_type> scrolled_rows;
+    viewport_->on_scroll.connect(
+        [&](terminalpp::rectangle const &region, 
+            terminalpp::coordinate_type rows)
+        {
+            EXPECT_EQ(terminalpp::rectangle({0, 0}, {3, 3}), region);
+            scrolled_rows = rows;
+            return true;
+        });
+
+    boost::optional<terminalpp::rectangle> redraw_region;
+    viewport_->on_redraw.connect(
+        [&](munin::rectangle_list const &regions)
+        {
+            ASSERT_EQ(1u, regions.size());
+            redraw_region = regions[0];
+        });
+
+    tracked_component_->set_cursor_position(cursor_movement);
+
+    ASSERT_EQ(expected_scrolled_rows, scrolled_rows);
+    ASSERT_EQ(expected_redraw_region, redraw_region);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    moving_cursors_scroll_viewports,
+    viewport_cursor_movement_scroll_test,
+    ValuesIn({
+        // Moving the cursor just below the viewed area scrolls the content
+        // up by one row, and only the newly exposed bottom row is redrawn.
+        cursor_movement_scroll_test_data{
+            {}, {0, 3}, 1, terminalpp::rectangle{{0, 2}, {3, 1}}
+        },
+
+        cursor_movement_scroll_test_data{
+            {{0, 4}}, {0, 0}, -2, terminalpp::rectangle{{0, 0}, {3, 2}}
+        },
+
+        // Moving horizontally, or by a whole viewport or more, cannot be
+        // done by scrolling, and so the entire viewed area is redrawn.
+        cursor_movement_scroll_test_data{
+            {}, {3, 0}, boost::none, terminalpp::rectangle{{0, 0}, {3, 3}}
+        },
+
+        cursor_movement_scroll_test_data{
+            {}, {0, 5}, boost::none, terminalpp::rectangle{{0, 0}, {3, 3}}
+        },
+    })
+);
+
+TEST_F(a_viewport, redraws_everything_when_a_scroll_is_refused)
+{
+    using testing::Return;
+
+    ON_CALL(*tracked_component_, do_get_preferred_size())
+        .WillByDefault(Return(terminalpp::extent{6, 6}));
+    tracked_component_->on_preferred_size_changed();
+    viewport_->set_size({3, 3});
+
+    int scroll_count = 0;
+    viewport_->on_scroll.connect(
+        [&scroll_count](auto const &, auto)
+        {
+            ++scroll_count;
+            return false;
+        });
+
+    boost::optional<terminalpp::rectangle> redraw_region;
+    viewport_->on_redraw.connect(
+        [&](munin::rectangle_list const &regions)
+        {
+            ASSERT_EQ(1u, regions.size());
+            redraw_region = regions[0];
+        });
+
+    ON_CALL(*tracked_component_, do_get_cursor_position())
+        .WillByDefault(Return(terminalpp::point{0, 3}));
+    tracked_component_->on_cursor_position_changed();
+
+    ASSERT_EQ(1, scroll_count);
+    ASSERT_EQ(terminalpp::rectangle({0, 0}, {3, 3}), redraw_region);
+}
@@ -121,10 +121,10 @@ TEST_F(a_viewport, with_a_size_larger_than_the_preferred_size_of_the_tracked_com
     {
         testing::InSequence _;
         
-        auto const preferred_size = terminalpp::extent{3, 3};
+        // The preferred size of the tracked component has not changed
+        // since it was last announced, and so is not queried again.
         auto const new_viewport_size = terminalpp::extent{7, 7};
-        EXPECT_CALL(*tracked_component_, do_get_preferred_size)
-            .WillOnce(Return(preferred_size));
+        EXPECT_CALL(*tracked_component_, do_get_preferred_size).Times(0);
         EXPECT_CALL(*tracked_component_, do_set_size(new_viewport_size));
         viewport_->set_size(new_viewport_size);
     }
@@ -160,10 +160,11 @@ TEST_F(a_viewport, with_a_size_smaller_than_the_tracked_component_allows_the_tra
     {
         testing::InSequence _;
         
+        // The preferred size of the tracked component has not changed
+        // since it was last announced, and so is not queried again.
         auto const preferred_size = terminalpp::extent{17, 4};
         auto const new_viewport_size = terminalpp::extent{3, 3};
-        EXPECT_CALL(*tracked_component_, do_get_preferred_size)
-            .WillOnce(Return(preferred_size));
+        EXPECT_CALL(*tracked_component_, do_get_preferred_size).Times(0);
         EXPECT_CALL(*tracked_component_, do_set_size(preferred_size));
         viewport_->set_size(new_viewport_size);
     }
@@ -385,6 +386,69 @@ TEST_F(a_viewport, draws_offset_area_when_viewport_position_is_offset)
     ASSERT_EQ(terminalpp::element{'l'}, cvs[2][1]);
 }
 
+TEST_F(a_viewport, does_not_let_a_scrolled_tracked_component_draw_outside_it)
+{
+    // The viewport is drawn at (1, 1) of a larger canvas, as it would be
+    // within a container.
+    terminalpp::canvas cvs{{5, 4}};
+    fill_canvas(cvs, 'x');
+
+    ON_CALL(*tracked_component_, do_get_preferred_size())
+        .WillByDefault(Return(terminalpp::extent{4, 3}));
+    tracked_component_->on_preferred_size_changed();
+
+    // The tracked component draws the whole of itself, regardless of the
+    // region that it is asked to draw.
+    ON_CALL(*tracked_component_, do_draw(_, _))
+        .WillByDefault(Invoke(
+            [](munin::render_surface& surface, 
+               terminalpp::rectangle const &)
+            {
+                terminalpp::for_each_in_region(
+                    surface,
+                    {{}, {4, 3}},
+                    [](terminalpp::element &elem,
+                       terminalpp::coordinate_type column,
+                       terminalpp::coordinate_type row)
+                    {
+                        elem = ('a' + column + (row * 4));
+                    });
+            }
+        ));
+    
+    viewport_->set_position({0, 0});
+    viewport_->set_size({3, 2});
+
+    // Scroll the viewport by (1, 1).
+    ON_CALL(*tracked_component_, do_get_cursor_state())
+        .WillByDefault(Return(true));
+    ON_CALL(*tracked_component_, do_get_cursor_position())
+        .WillByDefault(Return(terminalpp::point{3, 2}));
+    tracked_component_->on_cursor_position_changed();
+
+    munin::render_surface surface{cvs};
+    surface.offset_by({1, 1});
+    viewport_->draw(surface, {{}, viewport_->get_size()});
+
+    for (auto column = 0; column < 5; ++column)
+    {
+        ASSERT_EQ(terminalpp::element{'x'}, cvs[column][0]);
+        ASSERT_EQ(terminalpp::element{'x'}, cvs[column][3]);
+    }
+
+    ASSERT_EQ(terminalpp::element{'x'}, cvs[0][1]);
+    ASSERT_EQ(terminalpp::element{'x'}, cvs[0][2]);
+    ASSERT_EQ(terminalpp::element{'x'}, cvs[4][1]);
+    ASSERT_EQ(terminalpp::element{'x'}, cvs[4][2]);
+
+    ASSERT_EQ(terminalpp::element{'f'}, cvs[1][1]);
+    ASSERT_EQ(terminalpp::element{'g'}, cvs[2][1]);
+    ASSERT_EQ(terminalpp::element{'h'}, cvs[3][1]);
+    ASSERT_EQ(terminalpp::element{'j'}, cvs[1][2]);
+    ASSERT_EQ(terminalpp::element{'k'}, cvs[2][2]);
+    ASSERT_EQ(terminalpp::element{'l'}, cvs[3][2]);
+}
+
 TEST_F(a_viewport, translates_mouse_events_to_the_tracked_component)
 {
     auto const tracked_component_preferred_size = terminalpp::extent{5, 5};
@@ -0,0 +1,192 @@
+#include "mock/component.hpp"
+#include <munin/render_surface.hpp>
+#include <munin/scrollback.hpp>
+#include <munin/text_area.hpp>
+#include <munin/viewport.hpp>
+#include <munin/virtual_content.hpp>
+#include <terminalpp/canvas.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using testing::Invoke;
+using testing::ReturnPointee;
+using testing::SaveArg;
+using testing::_;
+
+namespace {
+
+class mock_virtual_component
+  : public mock_component,
+    public munin::virtual_content
+{
+public:
+    MOCK_CONST_METHOD0(do_get_content_extent, terminalpp::extent ());
+};
+
+class a_viewport_with_virtual_content : public testing::Test
+{
+protected:
+    a_viewport_with_virtual_content()
+    {
+        ON_CALL(*tracked_component_, do_get_size())
+            .WillByDefault(ReturnPointee(&tracked_component_size_));
+        ON_CALL(*tracked_component_, do_set_size(_))
+            .WillByDefault(SaveArg<0>(&tracked_component_size_));
+        ON_CALL(*tracked_component_, do_get_content_extent())
+            .WillByDefault(ReturnPointee(&content_extent_));
+        ON_CALL(*tracked_component_, do_get_cursor_position())
+            .WillByDefault(ReturnPointee(&tracked_cursor_position_));
+        ON_CALL(*tracked_component_, do_set_cursor_position(_))
+            .WillByDefault(Invoke([this](auto const &pos) {
+                tracked_cursor_position_ = pos;
+                tracked_component_->on_cursor_position_changed();
+            }));
+
+        // The preferred size of virtual content should never be asked for,
+        // since it may be expensive to compute.
+        EXPECT_CALL(*tracked_component_, do_get_preferred_size()).Times(0);
+    }
+
+    std::shared_ptr<mock_virtual_component> tracked_component_ =
+        std::make_shared<testing::NiceMock<mock_virtual_component>>();
+    std::shared_ptr<munin::viewport> viewport_ =
+        munin::make_viewport(tracked_component_);
+
+    terminalpp::extent tracked_component_size_;
+    terminalpp::extent content_extent_{10, 2000};
+    terminalpp::point tracked_cursor_position_;
+};
+
+}
+
+TEST_F(a_viewport_with_virtual_content, prefers_the_extent_of_the_content)
+{
+    ASSERT_EQ(terminalpp::extent(10, 2000), viewport_->get_preferred_size());
+}
+
+TEST_F(a_viewport_with_virtual_content, sizes_the_content_to_the_viewport)
+{
+    viewport_->set_size({4, 3});
+    ASSERT_EQ(terminalpp::extent(4, 3), tracked_component_->get_size());
+
+    // A change in the extent of the content does not change its size.
+    content_extent_ = {10, 4000};
+    tracked_component_->on_preferred_size_changed();
+    ASSERT_EQ(terminalpp::extent(4, 3), tracked_component_->get_size());
+    ASSERT_EQ(terminalpp::extent(10, 4000), viewport_->get_preferred_size());
+}
+
+TEST_F(a_viewport_with_virtual_content, follows_the_cursor_beyond_the_size_of_the_content)
+{
+    viewport_->set_size({4, 3});
+    tracked_component_->set_cursor_position({2, 1000});
+
+    ASSERT_EQ(terminalpp::point(2, 2), viewport_->get_cursor_position());
+
+    // Only the visible window of the content is requested.
+    EXPECT_CALL(
+        *tracked_component_,
+        do_draw(_, terminalpp::rectangle{{0, 998}, {4, 3}}));
+
+    terminalpp::canvas cvs{{4, 3}};
+    munin::render_surface surface{cvs};
+    viewport_->draw(surface, {{}, viewport_->get_size()});
+}
+
+TEST_F(a_viewport_with_virtual_content, does_not_scroll_beyond_the_extent_of_the_content)
+{
+    viewport_->set_size({4, 3});
+    tracked_component_->set_cursor_position({2, 1999});
+    ASSERT_EQ(terminalpp::point(2, 2), viewport_->get_cursor_position());
+
+    content_extent_ = {10, 2};
+    viewport_->set_size({4, 5});
+    tracked_component_->set_cursor_position({0, 0});
+    ASSERT_EQ(terminalpp::point(0, 0), viewport_->get_cursor_position());
+
+    EXPECT_CALL(
+        *tracked_component_,
+        do_draw(_, terminalpp::rectangle{{0, 0}, {4, 5}}));
+
+    terminalpp::canvas cvs{{4, 5}};
+    munin::render_surface surface{cvs};
+    viewport_->draw(surface, {{}, viewport_->get_size()});
+}
+
+TEST(a_viewport_onto_a_scrollback, keeps_the_scrollback_the_size_of_the_viewport)
+{
+    auto const scrollback = munin::make_scrollback();
+    auto const viewport = munin::make_viewport(scrollback);
+    viewport->set_size({3, 2});
+
+    for (auto line = 0; line < 100; ++line)
+    {
+        scrollback->insert_text("ab\n");
+    }
+
+    scrollback->insert_text("cd");
+
+    ASSERT_EQ(terminalpp::extent(3, 2), scrollback->get_size());
+    ASSERT_EQ(terminalpp::extent(3, 101), viewport->get_preferred_size());
+    ASSERT_EQ(terminalpp::point(2, 1), viewport->get_cursor_position());
+
+    terminalpp::canvas cvs{{3, 2}};
+    munin::render_surface surface{cvs};
+    viewport->draw(surface, {{}, viewport->get_size()});
+
+    ASSERT_EQ(terminalpp::element{'a'}, cvs[0][0]);
+    ASSERT_EQ(terminalpp::element{'b'}, cvs[1][0]);
+    ASSERT_EQ(terminalpp::element{'c'}, cvs[0][1]);
+    ASSERT_EQ(terminalpp::element{'d'}, cvs[1][1]);
+    ASSERT_EQ(terminalpp::element{' '}, cvs[2][1]);
+}
+
+TEST(a_viewport_onto_a_text_area, scrolls_long_lines_horizontally)
+{
+    auto const text_area = munin::make_text_area();
+    auto const viewport = munin::make_viewport(text_area);
+    viewport->set_size({3, 2});
+
+    text_area->insert_text("abcdef\nabcd");
+
+    // A text area is not virtual content, and so is sized to show its 
+    // lines in full rather than wrapping them.
+    ASSERT_EQ(terminalpp::extent(6, 2), text_area->get_size());
+    ASSERT_EQ(terminalpp::extent(6, 2), viewport->get_preferred_size());
+    ASSERT_EQ(terminalpp::point(2, 1), viewport->get_cursor_position());
+
+    terminalpp::canvas cvs{{3, 2}};
+    munin::render_surface surface{cvs};
+    viewport->draw(surface, {{}, viewport->get_size()});
+
+    ASSERT_EQ(terminalpp::element{'c'}, cvs[0][0]);
+    ASSERT_EQ(terminalpp::element{'d'}, cvs[1][0]);
+    ASSERT_EQ(terminalpp::element{'e'}, cvs[2][0]);
+    ASSERT_EQ(terminalpp::element{'c'}, cvs[0][1]);
+    ASSERT_EQ(terminalpp::element{'d'}, cvs[1][1]);
+    ASSERT_EQ(terminalpp::element{' '}, cvs[2][1]);
+}
+
+TEST(a_viewport_onto_a_scrollback, follows_the_extent_of_the_content_when_resized)
+{
+    auto const scrollback = munin::make_scrollback();
+    auto const viewport = munin::make_viewport(scrollback);
+    viewport->set_size({3, 2});
+
+    scrollback->insert_text("abcdef");
+    ASSERT_EQ(terminalpp::extent(3, 3), viewport->get_preferred_size());
+
+    int preferred_size_changed_count = 0;
+    viewport->on_preferred_size_changed.connect(
+        [&preferred_size_changed_count]
+        {
+            ++preferred_size_changed_count;
+        });
+
+    // The text is now laid out on one row, so the extent of the content
+    // changes with the width.
+    viewport->set_size({6, 2});
+
+    ASSERT_NE(0, preferred_size_changed_count);
+    ASSERT_EQ(terminalpp::extent(6, 2), viewport->get_preferred_size());
+}
@@ -1,4 +1,5 @@
 #include "window_test.hpp"
+#include <munin/render_surface.hpp>
 #include <terminalpp/canvas.hpp>
 #include <terminalpp/screen.hpp>
 #include <terminalpp/terminal.hpp>
@@ -76,11 +77,11 @@ protected :
         reset_canvas(canvas_);
         
         ON_CALL(*content_, do_draw(_, _))
-            .WillByDefault(WithArgs<1>(Invoke(
-                [this](auto const &region)
+            .WillByDefault(Invoke(
+                [this](auto &surface, auto const &region)
                 {
-                    this->increment_elements_within(region);
-                })));
+                    this->increment_elements_within(surface, region);
+                }));
                
                // TODO: mock impl of set/get size 
         ON_CALL(*content_, do_set_size(_))
@@ -111,13 +112,15 @@ protected :
         }
     }
     
-    void increment_elements_within(terminalpp::rectangle const &region)
+    void increment_elements_within(
+        munin::render_surface &surface,
+        terminalpp::rectangle const &region)
     {
         for (auto y = region.origin.y; y < region.origin.y + region.size.height; ++y)
         {
             for (auto x = region.origin.x; x < region.origin.x + region.size.width; ++x)
             {
-                ++canvas_[x][y].glyph_.character_;
+                ++surface[x][y].glyph_.character_;
             }
         }
     }
@@ -243,6 +246,31 @@ TEST_F(repainting_a_window, after_a_repaint_with_two_discrete_regions_repaints_o
     }
 }
 
+TEST_F(repainting_a_window, after_a_repaint_with_overlapping_regions_repaints_each_cell_once)
+{
+    window_->repaint(canvas_, terminal_);
+    reset_canvas(canvas_);
+    
+    content_->on_redraw({
+        {{0, 0}, {10, 2}},
+        {{5, 1}, {10, 2}}
+    });
+    content_->on_redraw({{{0, 0}, {10, 2}}});
+    window_->repaint(canvas_, terminal_);
+
+    for (auto y = 0; y < window_size.height; ++y)
+    {
+        for (auto x = 0; x < window_size.width; ++x)
+        {
+            bool const in_region = 
+                (y < 2 && x < 10)
+             || (y >= 1 && y < 3 && x >= 5 && x < 15);
+
+            ASSERT_EQ(in_region ? 1 : 0, canvas_[x][y].glyph_.character_);
+        }
+    }
+}
+
 TEST_F(repainting_a_window, with_no_changes_returns_empty_paint_data)
 {
     window_->repaint(canvas_, terminal_);
@@ -274,3 +302,233 @@ TEST_F(repainting_a_window, with_one_change_returns_paint_data_for_that_region)
  
     ASSERT_EQ(expected_data, paint_data);
 }
+
+TEST_F(repainting_a_window, outputs_only_changes_within_the_damaged_region)
+{
+    window_->repaint(canvas_, terminal_);
+
+    // A change to the canvas that the content did not ask to be redrawn
+    // is not part of the damage, and so is not output.
+    canvas_[15][30].glyph_.character_ = 'x';
+
+    terminalpp::terminal terminal;
+    content_->on_redraw({{{}, {1, 1}}});
+    std::string paint_data = window_->repaint(canvas_, terminal);
+
+    terminalpp::terminal expected_terminal;
+    std::string expected_data = 
+        expected_terminal.move_cursor({0, 0})
+      + expected_terminal.write(terminalpp::string{canvas_[0][0]});
+
+    ASSERT_EQ(expected_data, paint_data);
+}
+
+TEST_F(repainting_a_window, outputs_a_run_of_changed_cells_with_a_single_cursor_movement)
+{
+    window_->repaint(canvas_, terminal_);
+
+    terminalpp::terminal terminal;
+    content_->on_redraw({{{2, 3}, {5, 1}}});
+    std::string paint_data = window_->repaint(canvas_, terminal);
+
+    terminalpp::string expected_run;
+    
+    for (auto x = 2; x < 7; ++x)
+    {
+        expected_run += canvas_[x][3];
+    }
+
+    terminalpp::terminal expected_terminal;
+    std::string expected_data = 
+        expected_terminal.move_cursor({2, 3})
+      + expected_terminal.write(expected_run);
+
+    ASSERT_EQ(expected_data, paint_data);
+}
+
+TEST_F(repainting_a_window, into_a_buffer_appends_paint_data_to_that_buffer)
+{
+    window_->repaint(canvas_, terminal_);
+
+    terminalpp::terminal terminal;
+    content_->on_redraw({{{1, 1}, {3, 2}}});
+
+    std::string paint_data = "prefix";
+    window_->repaint(canvas_, terminal, paint_data);
+
+    terminalpp::terminal expected_terminal;
+    std::string expected_data = "prefix";
+
+    for (auto y = 1; y < 3; ++y)
+    {
+        terminalpp::string expected_run;
+
+        for (auto x = 1; x < 4; ++x)
+        {
+            expected_run += canvas_[x][y];
+        }
+
+        expected_data += expected_terminal.move_cursor({1, y});
+        expected_data += expected_terminal.write(expected_run);
+    }
+
+    ASSERT_EQ(expected_data, paint_data);
+}
+
+TEST_F(repainting_a_window, records_statistics_about_the_repaint)
+{
+    auto const &statistics = window_->get_statistics();
+    ASSERT_EQ(0u, statistics.repaints);
+    
+    std::string paint_data = window_->repaint(canvas_, terminal_);
+    
+    ASSERT_EQ(1u, statistics.repaints);
+    ASSERT_EQ(0u, statistics.repaint_requests);
+    ASSERT_EQ(1u, statistics.merged_regions);
+    ASSERT_EQ(std::uint64_t(window_size.width * window_size.height), statistics.cells_drawn);
+    ASSERT_EQ(window_size, statistics.largest_region);
+    ASSERT_EQ(paint_data.size(), statistics.bytes_emitted);
+    
+    content_->on_redraw({{{0, 0}, {2, 2}}, {{1, 1}, {2, 2}}});
+    content_->on_redraw({{{10, 10}, {3, 1}}});
+    paint_data += window_->repaint(canvas_, terminal_);
+    
+    ASSERT_EQ(2u, statistics.repaints);
+    ASSERT_EQ(2u, statistics.repaint_requests);
+    ASSERT_EQ(1u + 4u, statistics.merged_regions);
+    ASSERT_EQ(std::uint64_t(window_size.width * window_size.height) + 7u + 3u, statistics.cells_drawn);
+    ASSERT_EQ(window_size, statistics.largest_region);
+    ASSERT_EQ(paint_data.size(), statistics.bytes_emitted);
+}
+
+TEST_F(repainting_a_window, outputs_nothing_when_a_redraw_leaves_the_canvas_unchanged)
+{
+    window_->repaint(canvas_, terminal_);
+
+    // Redraw the same content into the region that was just drawn.
+    EXPECT_CALL(*content_, do_draw(_, _))
+        .WillOnce(Invoke(
+            [this](munin::render_surface &surface, auto const &region)
+            {
+                surface.fill_rect(region, canvas_[0][0]);
+            }));
+    
+    content_->on_redraw({{{}, {5, 5}}});
+    std::string paint_data = window_->repaint(canvas_, terminal_);
+
+    ASSERT_EQ("", paint_data);
+}
+
+TEST_F(repainting_a_window, scrolls_a_full_width_region_with_the_terminal)
+{
+    window_->repaint(canvas_, terminal_);
+    canvas_[0][11].glyph_.character_ = 'x';
+
+    auto const accepted = 
+        content_->on_scroll({{0, 10}, {20, 5}}, 1).get_value_or(false);
+    content_->on_redraw({{{0, 14}, {20, 1}}});
+
+    terminalpp::terminal terminal;
+    std::string paint_data = window_->repaint(canvas_, terminal);
+
+    // The canvas moves along with the terminal, and only the exposed row
+    // is written out.
+    ASSERT_TRUE(accepted);
+    ASSERT_EQ('x', canvas_[0][10].glyph_.character_);
+
+    terminalpp::string expected_row;
+
+    for (auto x = 0; x < window_size.width; ++x)
+    {
+        expected_row += canvas_[x][14];
+    }
+
+    terminalpp::terminal expected_terminal;
+    std::string expected_data = 
+        "\x1B[11;15r\x1B[1S\x1B[r"
+      + expected_terminal.move_cursor({0, 0})
+      + expected_terminal.move_cursor({0, 14})
+      + expected_terminal.write(expected_row);
+
+    ASSERT_EQ(expected_data, paint_data);
+    ASSERT_EQ(1u, window_->get_statistics().scrolls);
+}
+
+TEST_F(repainting_a_window, scrolls_down_with_the_terminal)
+{
+    window_->repaint(canvas_, terminal_);
+
+    content_->on_scroll({{0, 0}, {20, 40}}, -2);
+    content_->on_redraw({{{0, 0}, {20, 2}}});
+
+    terminalpp::terminal terminal;
+    std::string paint_data = window_->repaint(canvas_, terminal);
+
+    terminalpp::terminal expected_terminal;
+    std::string expected_data = 
+        "\x1B[1;40r\x1B[2T\x1B[r"
+      + expected_terminal.move_cursor({0, 0});
+
+    for (auto y = 0; y < 2; ++y)
+    {
+        terminalpp::string expected_row;
+
+        for (auto x = 0; x < window_size.width; ++x)
+        {
+            expected_row += canvas_[x][y];
+        }
+
+        expected_data += expected_terminal.move_cursor({0, y});
+        expected_data += expected_terminal.write(expected_row);
+    }
+
+    ASSERT_EQ(expected_data, paint_data);
+    ASSERT_EQ(1u, window_->get_statistics().scrolls);
+}
+
+TEST_F(repainting_a_window, counts_the_bytes_of_a_scroll_as_emitted)
+{
+    window_->repaint(canvas_, terminal_);
+    auto const bytes_before_scroll = window_->get_statistics().bytes_emitted;
+
+    content_->on_scroll({{0, 10}, {20, 5}}, 1);
+    std::string paint_data = window_->repaint(canvas_, terminal_);
+
+    ASSERT_EQ(0u, paint_data.find("\x1B[11;15r\x1B[1S\x1B[r"));
+    ASSERT_EQ(
+        bytes_before_scroll + paint_data.size(),
+        window_->get_statistics().bytes_emitted);
+}
+
+TEST_F(repainting_a_window, repaints_a_scrolled_region_that_is_not_full_width)
+{
+    window_->repaint(canvas_, terminal_);
+
+    auto const accepted = 
+        content_->on_scroll({{2, 10}, {5, 5}}, 1).get_value_or(false);
+    std::string paint_data = window_->repaint(canvas_, terminal_);
+
+    // The whole region is drawn again instead, once more incrementing 
+    // each of its cells.
+    ASSERT_TRUE(accepted);
+    ASSERT_EQ(std::string::npos, paint_data.find("r\x1B[r"));
+    ASSERT_EQ(2, canvas_[2][10].glyph_.character_);
+    ASSERT_EQ(1, canvas_[1][10].glyph_.character_);
+    ASSERT_EQ(0u, window_->get_statistics().scrolls);
+}
+
+TEST_F(repainting_a_window, moves_waiting_redraws_along_with_a_scroll)
+{
+    window_->repaint(canvas_, terminal_);
+
+    content_->on_redraw({{{3, 12}, {1, 1}}});
+    content_->on_scroll({{0, 10}, {20, 5}}, 1);
+    content_->on_redraw({{{0, 14}, {20, 1}}});
+    window_->repaint(canvas_, terminal_);
+
+    // The cell that was to be redrawn has moved up a row, so both its old
+    // and new positions are drawn.
+    ASSERT_EQ(2, canvas_[3][11].glyph_.character_);
+    ASSERT_EQ(2, canvas_[3][12].glyph_.character_);
+    ASSERT_EQ(1, canvas_[4][12].glyph_.character_);
+}